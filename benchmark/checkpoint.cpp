@@ -0,0 +1,60 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Benchmarks for incremental checkpoints against full dumps.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include <unistd.h>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/checkpoint.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Compares incremental checkpoints of a table with a small fraction of changed rows
+ * against full dumps of the same table.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("incremental checkpoint", "[checkpoint][benchmark]", ((size_t P), P), 1, 10)
+{
+    constexpr size_t n = size_t(1) << 22;
+
+    char name[] = "/tmp/supertuple-XXXXXX";
+    ::close(::mkstemp(name));
+
+    st::tracked_soa_t<uint64_t, double, uint32_t> table (n);
+    std::mt19937_64 rng (P);
+
+    for (size_t i = 0; i < n; ++i)
+        table.assign(i, st::tuple_t<uint64_t, double, uint32_t>(rng(), (double) i, (uint32_t) i));
+
+    table.checkpoint(name, true);
+
+    // Changes a fraction of rows in bursts, as writes to a table are usually local.
+    auto change = [&]() {
+        for (size_t i = 0; i < n * P / 100; i += 64) {
+            const size_t first = rng() % (n - 64);
+            for (size_t j = first; j < first + 64; ++j) table.at<1>(j) += 1.;
+        }
+    };
+
+    BENCHMARK("full dump") {
+        change();
+        return table.checkpoint(name, true);
+    };
+
+    BENCHMARK("incremental checkpoint") {
+        change();
+        return table.checkpoint(name);
+    };
+
+    std::remove(name);
+}
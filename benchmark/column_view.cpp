@@ -0,0 +1,71 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Benchmarks for strided column views against structure-of-arrays copies.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/column_view.hpp>
+
+namespace st = supertuple;
+
+/**
+ * A record with a small hot column among wider fields, so that consecutive values
+ * of the column are a cache line apart.
+ * @since 1.0
+ */
+using record_t = st::tuple_t<int64_t, double, int32_t, std::array<char, 40>>;
+
+/**
+ * Compares aggregations over a column of an array of tuples, read in place through
+ * a strided view, against copying the column out into a contiguous array first, as
+ * converting to a structure of arrays would, and against an already copied column.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("column view aggregation", "[column_view][benchmark]", ((size_t N), N), 4096, 65536, 1048576)
+{
+    std::vector<record_t> rows (N);
+
+    for (size_t i = 0; i < N; ++i)
+        st::get<1>(rows[i]) = (double) (i % 1000) * 0.25;
+
+    const auto column = st::column_view<1>(std::as_const(rows));
+    std::vector<double> soa (N);
+
+    for (size_t i = 0; i < N; ++i) soa[i] = st::get<1>(rows[i]);
+
+    BENCHMARK("plain loop over tuples") {
+        double total = 0;
+        for (const auto& row : rows) total += st::get<1>(row);
+        return total;
+    };
+
+    BENCHMARK("column_view::sum") {
+        return column.sum();
+    };
+
+    BENCHMARK("copy to column and sum") {
+        std::vector<double> copy (N);
+        for (size_t i = 0; i < N; ++i) copy[i] = st::get<1>(rows[i]);
+        return std::accumulate(copy.begin(), copy.end(), 0.0);
+    };
+
+    BENCHMARK("sum of copied column") {
+        return std::accumulate(soa.begin(), soa.end(), 0.0);
+    };
+
+    BENCHMARK("column_view::max") {
+        return column.max();
+    };
+
+    BENCHMARK("column_view::count_if") {
+        return column.count_if([](double x) { return x > 100.0; });
+    };
+}
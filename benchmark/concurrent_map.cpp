@@ -0,0 +1,82 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Benchmarks for the concurrent tuple map's scaling over threads.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/concurrent_map.hpp>
+#include <supertuple/detail/parallel.hpp>
+
+namespace st = supertuple;
+
+using pair_key_t = st::tuple_t<uint32_t, uint32_t>;
+
+/**
+ * Runs a mixed workload of lookups and updates on multiple threads. One in ten
+ * operations is an update, and keys are spread uniformly over the key space.
+ * @tparam F The lookup functor type.
+ * @tparam G The update functor type.
+ * @param threads The number of threads to run the workload on.
+ * @param find The lookup of a key.
+ * @param update The update of a key.
+ * @return The number of keys found.
+ */
+template <typename F, typename G>
+static size_t workload(size_t threads, const F& find, const G& update)
+{
+    constexpr size_t operations = size_t(1) << 20;
+    std::atomic<size_t> found = 0;
+
+    st::detail::parallel::run(threads, [&](size_t id) {
+        uint64_t state = id * 0x9e3779b97f4a7c15ULL + 1;
+        size_t local = 0;
+
+        for (size_t i = 0; i < operations / threads; ++i) {
+            state = st::detail::mix(state);
+            const pair_key_t key ((uint32_t) (state % 100000), (uint32_t) (state >> 40) % 10);
+
+            if (state % 10 == 0) update(key);
+            else local += find(key);
+        }
+
+        found += local;
+    });
+
+    return found;
+}
+
+/**
+ * Compares the concurrent tuple map against a standard map behind a shared mutex,
+ * from a single thread up to many more threads than cores.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("concurrent map scaling", "[concurrent_map][benchmark]", ((size_t P), P), 1, 2, 4, 8, 16, 32, 64)
+{
+    st::concurrent_tuple_map<pair_key_t, uint64_t> map;
+    std::unordered_map<pair_key_t, uint64_t> locked;
+    std::shared_mutex mutex;
+
+    for (uint32_t i = 0; i < 100000; i += 2)
+        for (uint32_t j = 0; j < 10; ++j)
+            map.insert(pair_key_t(i, j), i), locked.emplace(pair_key_t(i, j), i);
+
+    BENCHMARK("std::unordered_map with shared mutex") {
+        return workload(P
+          , [&](const pair_key_t& key) { std::shared_lock lock (mutex); return locked.count(key); }
+          , [&](const pair_key_t& key) { std::unique_lock lock (mutex); ++locked[key]; });
+    };
+
+    BENCHMARK("concurrent_tuple_map") {
+        return workload(P
+          , [&](const pair_key_t& key) { return (size_t) map.contains(key); }
+          , [&](const pair_key_t& key) { map.upsert(key, [](uint64_t& v) { ++v; }); });
+    };
+}
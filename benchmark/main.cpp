@@ -0,0 +1,8 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The main file for running all benchmarks in the project.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
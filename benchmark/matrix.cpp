@@ -0,0 +1,124 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Benchmarks for the fixed-size matrix kernels against naive loops.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/matrix.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Multiplies two square matrices with naive run-time loops.
+ * @param a The left-hand matrix's elements.
+ * @param b The right-hand matrix's elements.
+ * @param c The product's elements.
+ * @param n The matrices' size.
+ */
+static void naive_matmul(const double *a, const double *b, double *c, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            double sum = 0;
+            for (size_t k = 0; k < n; ++k) sum += a[i * n + k] * b[k * n + j];
+            c[i * n + j] = sum;
+        }
+}
+
+/**
+ * Inverts a square matrix with naive run-time Gauss-Jordan elimination.
+ * @param a The matrix's elements, destroyed by the elimination.
+ * @param r The inverse's elements.
+ * @param n The matrix's size.
+ */
+static void naive_inverse(double *a, double *r, size_t n)
+{
+    for (size_t i = 0; i < n * n; ++i) r[i] = (i / n == i % n);
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t p = k;
+        for (size_t i = k + 1; i < n; ++i) if (std::abs(a[i * n + k]) > std::abs(a[p * n + k])) p = i;
+        for (size_t j = 0; j < n; ++j) std::swap(a[k * n + j], a[p * n + j]), std::swap(r[k * n + j], r[p * n + j]);
+
+        const double d = a[k * n + k];
+        for (size_t j = 0; j < n; ++j) a[k * n + j] /= d, r[k * n + j] /= d;
+
+        for (size_t i = 0; i < n; ++i) {
+            if (i == k) continue;
+            const double f = a[i * n + k];
+            for (size_t j = 0; j < n; ++j) a[i * n + j] -= f * a[k * n + j], r[i * n + j] -= f * r[k * n + j];
+        }
+    }
+}
+
+/**
+ * Generates a random well-conditioned square matrix.
+ * @tparam N The matrix's size.
+ * @return The generated matrix.
+ */
+template <size_t N>
+static st::matrix_t<double, N, N> generate()
+{
+    std::mt19937 rng (N);
+    std::uniform_real_distribution<double> dist (-1., 1.);
+    double data[N * N];
+
+    for (size_t i = 0; i < N * N; ++i)
+        data[i] = dist(rng) + (i / N == i % N ? N : 0);
+
+    return st::matrix_t<double, N, N>(data);
+}
+
+/**
+ * Compares unrolled matrix products against naive loops.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("matrix product", "[matrix][benchmark]", ((size_t N), N), 3, 4, 6)
+{
+    auto a = generate<N>();
+    auto b = generate<N>();
+    double x[N * N], y[N * N], z[N * N];
+
+    for (size_t i = 0; i < N; ++i)
+        for (size_t j = 0; j < N; ++j)
+            x[i * N + j] = a(i, j), y[i * N + j] = b(i, j);
+
+    BENCHMARK("naive loops") {
+        naive_matmul(x, y, z, N);
+        return z[N + 1];
+    };
+
+    BENCHMARK("matrix_t") {
+        a = a * b;
+        return a.template at<1, 1>();
+    };
+}
+
+/**
+ * Compares unrolled matrix inverses against naive loops.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("matrix inverse", "[matrix][benchmark]", ((size_t N), N), 3, 4, 6)
+{
+    const auto m = generate<N>();
+    double x[N * N], y[N * N];
+
+    BENCHMARK("naive loops") {
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j)
+                x[i * N + j] = m(i, j);
+        naive_inverse(x, y, N);
+        return y[0];
+    };
+
+    BENCHMARK("matrix_t") {
+        return st::inverse(m).template at<0, 0>();
+    };
+}
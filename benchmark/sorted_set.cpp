@@ -0,0 +1,97 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Benchmarks for the read-only sorted sets against binary searches.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/sorted_set.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Generates a sequence of distinct odd values, in scrambled order.
+ * @tparam N The sequence's length.
+ * @return The generated sequence.
+ */
+template <size_t N>
+static constexpr std::array<uint32_t, N> odds()
+{
+    std::array<uint32_t, N> data {};
+    for (size_t i = 0; i < N; ++i) data[i] = (uint32_t) (((i * 7919) % N) * 2 + 1);
+    return data;
+}
+
+/**
+ * Generates random queries over the range of a set's values.
+ * @param n The set's number of elements.
+ * @return The generated queries.
+ */
+static std::vector<uint32_t> queries(size_t n)
+{
+    std::mt19937 rng (n);
+    std::uniform_int_distribution<uint32_t> dist (0, (uint32_t) n * 2);
+    std::vector<uint32_t> result (4096);
+    for (auto& x : result) x = dist(rng);
+    return result;
+}
+
+/**
+ * Compares the compile-time sorted sets against the standard binary search.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("static sorted set", "[sorted_set][benchmark]", ((size_t N), N), 16, 64, 512)
+{
+    static constexpr auto data = odds<N>();
+    static constexpr st::static_sorted_set set (st::ntuple_t<uint32_t, N>(data.data()));
+
+    std::vector<uint32_t> sorted (data.begin(), data.end());
+    std::sort(sorted.begin(), sorted.end());
+    const auto q = queries(N);
+
+    BENCHMARK("std::lower_bound") {
+        size_t found = 0;
+        for (uint32_t x : q) found += std::binary_search(sorted.begin(), sorted.end(), x);
+        return found;
+    };
+
+    BENCHMARK("static_sorted_set") {
+        size_t found = 0;
+        for (uint32_t x : q) found += set.contains(x);
+        return found;
+    };
+}
+
+/**
+ * Compares the run-time sorted sets against the standard binary search, for sets
+ * that fit in cache and sets that do not.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("run-time sorted set", "[sorted_set][benchmark]", ((size_t N), N), 64, 4096, 1048576, 16777216)
+{
+    std::vector<uint32_t> sorted (N);
+    for (size_t i = 0; i < N; ++i) sorted[i] = (uint32_t) (i * 2 + 1);
+
+    const st::sorted_set<uint32_t> set (sorted);
+    const auto q = queries(N);
+
+    BENCHMARK("std::lower_bound") {
+        size_t found = 0;
+        for (uint32_t x : q) found += std::binary_search(sorted.begin(), sorted.end(), x);
+        return found;
+    };
+
+    BENCHMARK("sorted_set") {
+        size_t found = 0;
+        for (uint32_t x : q) found += set.contains(x);
+        return found;
+    };
+}
@@ -0,0 +1,583 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The external sort of tuple datasets larger than memory.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/algorithm/keys.hpp>
+#include <supertuple/algorithm/merge.hpp>
+#include <supertuple/io/serialize.hpp>
+#include <supertuple/io/source.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * A background thread which runs I/O tasks in the order they are submitted, so
+     * that reads and writes of files are overlapped with computations on the caller.
+     * Errors thrown by a task are reported through its future.
+     * @since 1.0
+     */
+    class io_worker_t
+    {
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_ready;
+            std::deque<std::packaged_task<void()>> m_tasks;
+            bool m_stop = false;
+            std::thread m_thread;
+
+        public:
+            inline io_worker_t(const io_worker_t&) noexcept = delete;
+            inline io_worker_t(io_worker_t&&) noexcept = delete;
+
+            /**
+             * Starts the worker's thread.
+             */
+            inline io_worker_t()
+              : m_thread ([this]() { run(); })
+            {}
+
+            /**
+             * Runs all pending tasks and stops the worker's thread.
+             */
+            inline ~io_worker_t()
+            {
+                {
+                    std::lock_guard lock (m_mutex);
+                    m_stop = true;
+                }
+
+                m_ready.notify_one();
+                m_thread.join();
+            }
+
+            inline io_worker_t& operator=(const io_worker_t&) noexcept = delete;
+            inline io_worker_t& operator=(io_worker_t&&) noexcept = delete;
+
+            /**
+             * Queues a task to be run by the worker.
+             * @tparam F The task functor type.
+             * @param lambda The task to be run.
+             * @return The future to wait for the task's completion with.
+             */
+            template <typename F>
+            inline std::future<void> submit(F&& lambda)
+            {
+                std::packaged_task<void()> task (std::forward<F>(lambda));
+                std::future<void> future = task.get_future();
+
+                {
+                    std::lock_guard lock (m_mutex);
+                    m_tasks.push_back(std::move(task));
+                }
+
+                m_ready.notify_one();
+                return future;
+            }
+
+        private:
+            /**
+             * The worker's main loop, which runs tasks until it is stopped.
+             */
+            inline void run()
+            {
+                for (std::unique_lock lock (m_mutex); ; ) {
+                    m_ready.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+                    if (m_tasks.empty()) return;
+
+                    std::packaged_task<void()> task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+
+                    lock.unlock();
+                    task();
+                    lock.lock();
+                }
+            }
+    };
+
+    /**
+     * Waits for a pending I/O task when leaving a scope, so that buffers used by
+     * the task are not destroyed while it still runs, even if an error unwinds them.
+     * @since 1.0
+     */
+    class wait_guard_t
+    {
+        private:
+            std::future<void>& m_future;
+
+        public:
+            inline wait_guard_t(const wait_guard_t&) noexcept = delete;
+            inline wait_guard_t(wait_guard_t&&) noexcept = delete;
+
+            /**
+             * Guards a future to be waited for.
+             * @param future The future of the pending task.
+             */
+            inline explicit wait_guard_t(std::future<void>& future) noexcept
+              : m_future (future)
+            {}
+
+            /**
+             * Waits for the guarded task, if any is still pending.
+             */
+            inline ~wait_guard_t()
+            {
+                if (m_future.valid()) m_future.wait();
+            }
+
+            inline wait_guard_t& operator=(const wait_guard_t&) noexcept = delete;
+            inline wait_guard_t& operator=(wait_guard_t&&) noexcept = delete;
+    };
+
+    /**
+     * A temporary file holding a sorted run of encoded records. The file is unlinked
+     * as soon as it is created, so it is removed by the system once it is closed,
+     * even if the process is interrupted.
+     * @since 1.0
+     */
+    struct spill_t
+    {
+        int fd = -1;
+        size_t count = 0;
+
+        inline spill_t(const spill_t&) noexcept = delete;
+
+        /**
+         * Creates a new temporary file in the given directory.
+         * @param dir The directory to create the file in.
+         */
+        inline explicit spill_t(const std::string& dir)
+        {
+            std::string name = dir + "/supertuple-sort-XXXXXX";
+
+            if ((fd = ::mkstemp(name.data())) < 0)
+                throw std::system_error(errno, std::generic_category(), "cannot create temporary file");
+
+            ::unlink(name.c_str());
+        }
+
+        /**
+         * Moves a temporary file into a new instance.
+         * @param other The temporary file to be moved.
+         */
+        inline spill_t(spill_t&& other) noexcept
+          : fd (std::exchange(other.fd, -1))
+          , count (other.count)
+        {}
+
+        /**
+         * Closes and thus removes the temporary file.
+         */
+        inline ~spill_t()
+        {
+            if (fd >= 0) ::close(fd);
+        }
+
+        inline spill_t& operator=(const spill_t&) noexcept = delete;
+        inline spill_t& operator=(spill_t&&) noexcept = delete;
+    };
+
+    /**
+     * Reads back a sorted run from a temporary file, one record at a time. Blocks of
+     * the run are double-buffered, so that the next block is read in background
+     * while the current one is being consumed.
+     * @tparam T The type of records in the run.
+     * @since 1.0
+     */
+    template <typename T>
+    class run_reader_t
+    {
+        private:
+            static constexpr size_t size = io::record_size_v<T>;
+
+        private:
+            const spill_t& m_spill;
+            io_worker_t& m_worker;
+            std::vector<std::byte> m_buffer[2];
+            std::future<void> m_pending;
+            size_t m_block, m_current = 0;
+            size_t m_requested = 0, m_consumed = 0;
+            size_t m_position = 0, m_available = 0;
+            T m_record {};
+
+        public:
+            /**
+             * Starts reading a run from its temporary file.
+             * @param spill The temporary file holding the run.
+             * @param worker The background worker to read blocks with.
+             * @param block The number of records in each block.
+             */
+            inline run_reader_t(const spill_t& spill, io_worker_t& worker, size_t block)
+              : m_spill (spill)
+              , m_worker (worker)
+              , m_block (block)
+            {
+                m_buffer[0].resize(block * size);
+                m_buffer[1].resize(block * size);
+
+                if (m_spill.count > 0) {
+                    request(0);
+                    swap();
+                }
+            }
+
+            inline run_reader_t(const run_reader_t&) = delete;
+            inline run_reader_t& operator=(const run_reader_t&) = delete;
+
+            /**
+             * Waits for any pending read before the reader is destroyed.
+             */
+            inline ~run_reader_t()
+            {
+                if (m_pending.valid()) m_pending.wait();
+            }
+
+            /**
+             * Informs whether all of the run's records have been consumed.
+             * @return Is the run exhausted?
+             */
+            inline bool exhausted() const noexcept
+            {
+                return m_consumed == m_spill.count;
+            }
+
+            /**
+             * Retrieves the run's current record.
+             * @return The current record.
+             */
+            inline const T& current() const noexcept
+            {
+                return m_record;
+            }
+
+            /**
+             * Moves the reader to the run's next record.
+             */
+            inline void advance()
+            {
+                if (++m_consumed == m_spill.count) return;
+                if (++m_position == m_available) swap();
+                else io::decode(m_buffer[m_current].data() + m_position * size, m_record);
+            }
+
+        private:
+            /**
+             * Requests the run's next block to be read into the idle buffer.
+             * @param target The buffer to read the block into.
+             */
+            inline void request(size_t target)
+            {
+                const size_t first = m_requested;
+                const size_t count = std::min(m_block, m_spill.count - first);
+                std::byte *data = m_buffer[target].data();
+                const int fd = m_spill.fd;
+
+                m_requested += count;
+                m_pending = m_worker.submit([=]() {
+                    if (io::read_at(fd, data, count * size, first * size) < count * size)
+                        throw std::runtime_error("temporary file was truncated");
+                });
+            }
+
+            /**
+             * Waits for the pending block and makes it current, immediately requesting
+             * the following block into the buffer just released.
+             */
+            inline void swap()
+            {
+                const size_t count = std::min(m_block, m_spill.count - m_consumed);
+
+                m_pending.get();
+                m_current = (m_requested - count) / m_block % 2;
+                m_position = 0;
+                m_available = count;
+
+                if (m_requested < m_spill.count)
+                    request(m_current ^ 1);
+
+                io::decode(m_buffer[m_current].data(), m_record);
+            }
+    };
+
+    /**
+     * An input range over a sorted run, to be merged by the k-way merge.
+     * @tparam T The type of records in the run.
+     * @since 1.0
+     */
+    template <typename T>
+    struct run_range_t
+    {
+        /**
+         * An input iterator over a run's records. All iterators share the reader's
+         * state, and an iterator without a reader stands for the end of the run.
+         * @since 1.0
+         */
+        struct iterator_t
+        {
+            typedef std::input_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T *pointer;
+            typedef const T& reference;
+
+            run_reader_t<T> *reader = nullptr;
+
+            inline const T& operator*() const noexcept { return reader->current(); }
+            inline iterator_t& operator++() { reader->advance(); return *this; }
+            inline bool done() const noexcept { return reader == nullptr || reader->exhausted(); }
+            inline bool operator==(const iterator_t& other) const noexcept { return done() == other.done(); }
+            inline bool operator!=(const iterator_t& other) const noexcept { return done() != other.done(); }
+        };
+
+        run_reader_t<T> *reader = nullptr;
+
+        inline iterator_t begin() const noexcept { return iterator_t {reader}; }
+        inline iterator_t end() const noexcept { return iterator_t {}; }
+    };
+
+    /**
+     * Sorts records by the least significant digit radix sort over their normalized
+     * keys. The digits' histograms are all counted in a single initial pass, and
+     * digits on which all keys agree are skipped altogether, so that narrow keys
+     * only cost as many passes as their bytes that actually vary.
+     * @tparam K The key selection type.
+     * @tparam T The records' type.
+     * @param data The records to be sorted.
+     * @param scratch The scratch buffer, with room for as many records.
+     * @param n The number of records to be sorted.
+     * @return The buffer with the sorted records, either the input or the scratch.
+     */
+    template <typename K, typename T>
+    inline T *radix_sort(T *data, T *scratch, size_t n)
+    {
+        std::vector<size_t> counts (sizeof(uint64_t) * 256);
+
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t key = K::normalize(data[i]);
+            for (size_t d = 0; d < sizeof(uint64_t); ++d)
+                ++counts[d * 256 + ((key >> (d * 8)) & 0xff)];
+        }
+
+        for (size_t d = 0; d < sizeof(uint64_t); ++d) {
+            size_t *count = counts.data() + d * 256;
+            if (*std::max_element(count, count + 256) == n) continue;
+
+            for (size_t b = 0, sum = 0; b < 256; ++b)
+                sum += std::exchange(count[b], sum);
+
+            for (size_t i = 0; i < n; ++i)
+                scratch[count[(K::normalize(data[i]) >> (d * 8)) & 0xff]++] = std::move(data[i]);
+
+            std::swap(data, scratch);
+        }
+
+        return data;
+    }
+
+    /**
+     * Sorts records in memory by their keys, with a radix sort if the keys can be
+     * normalized, or with a comparison sort otherwise.
+     * @tparam K The key selection type.
+     * @tparam T The records' type.
+     * @param data The records to be sorted.
+     * @param scratch The scratch buffer, with room for as many records.
+     * @param n The number of records to be sorted.
+     * @return The buffer with the sorted records, either the input or the scratch.
+     */
+    template <typename K, typename T>
+    inline T *sort(T *data, T *scratch, size_t n)
+    {
+        if constexpr (K::template normalizable<T>) {
+            return detail::radix_sort<K>(data, scratch, n);
+        } else {
+            std::sort(data, data + n, [](const T& a, const T& b) {
+                return K::template compare<K>(a, b) < 0; });
+            return data;
+        }
+    }
+}
+
+/**
+ * Sorts a dataset of tuple records which may be larger than the available memory.
+ * The input is split into runs as large as the memory budget allows, which are
+ * sorted in memory and spilled to temporary files in the compact binary format. The
+ * runs are then merged, in as many passes as needed for the budget to hold a block
+ * of every run being merged. Spills, as well as the read-ahead of runs' blocks, are
+ * carried out by background threads while the next run is sorted or merged. If the
+ * whole input fits in a single run, nothing is ever written to disk. The order of
+ * records with equivalent keys is unspecified.
+ * @tparam I The indeces of the key elements in the tuples.
+ * @tparam R The input reader type, with a `read(T*, size_t)` method returning the
+ * number of records read, and zero at the end of the input.
+ * @tparam W The output writer functor type, invoked with a pointer and a count.
+ * @param reader The reader of the dataset to be sorted.
+ * @param writer The writer of sorted batches.
+ * @param budget The maximum number of bytes to be held in memory for records.
+ * @param dir The directory to create the temporary files in.
+ * @return The number of records sorted.
+ */
+template <size_t ...I, typename R, typename W>
+inline size_t external_sort(R& reader, W&& writer, size_t budget, const std::string& dir)
+{
+    using key_t = keys_t<I...>;
+    using value_t = typename std::decay_t<R>::value_t;
+
+    constexpr size_t record = io::record_size_v<value_t>;
+    constexpr size_t unit = record < (size_t(64) << 10) ? (size_t(64) << 10) / record : 1;
+
+    // While runs are created, the budget holds the run being sorted, its scratch
+    // buffer for the radix sort and the encoding of the previous run being spilled.
+    const size_t capacity = budget / (2 * sizeof(value_t) + record);
+
+    if (capacity == 0)
+        throw std::invalid_argument("memory budget is too small for a single record");
+
+    std::vector<value_t> data (capacity), scratch (capacity);
+    std::vector<std::byte> encoded;
+    std::deque<detail::spill_t> spills;
+    std::future<void> spilling;
+    size_t total = 0;
+
+    value_t lookahead {};
+    bool carried = false;
+
+    detail::io_worker_t writes;
+
+    for (bool eof = false; !eof; ) {
+        size_t n = 0;
+
+        if (carried) {
+            data[0] = std::move(lookahead);
+            carried = false;
+            n = 1;
+        }
+
+        while (n < capacity) {
+            const size_t r = reader.read(data.data() + n, capacity - n);
+            if (r == 0) { eof = true; break; }
+            n += r;
+        }
+
+        if (n == 0) break;
+
+        // A full first run may still hold the whole input, which is only known once
+        // the input's end is seen. Thus, a record is read ahead, so that such a run
+        // is not needlessly spilled, and carried over to the next run otherwise.
+        if (!eof && spills.empty())
+            carried = !(eof = reader.read(&lookahead, 1) == 0);
+
+        value_t *sorted = detail::sort<key_t>(data.data(), scratch.data(), n);
+        total += n;
+
+        if (eof && spills.empty()) {
+            for (size_t i = 0; i < n; i += unit)
+                writer((const value_t*) sorted + i, std::min(unit, n - i));
+            return total;
+        }
+
+        if (spilling.valid()) spilling.get();
+
+        encoded.clear();
+        io::encode(encoded, (const value_t*) sorted, n);
+
+        detail::spill_t& spill = spills.emplace_back(dir);
+        spill.count = n;
+
+        spilling = writes.submit([&encoded, fd = spill.fd]() {
+            io::write_at(fd, encoded.data(), encoded.size(), 0);
+        });
+    }
+
+    if (spilling.valid()) spilling.get();
+
+    std::vector<value_t>().swap(data);
+    std::vector<value_t>().swap(scratch);
+    std::vector<std::byte>().swap(encoded);
+
+    // While merging, the budget holds two blocks for every run being merged, besides
+    // the merged batch and, for intermediate passes, its two encodings being written.
+    // Runs are merged at least two at a time, so that every pass reduces their count.
+    const size_t slot = budget / unit;
+    const size_t fanin = slot > sizeof(value_t) + 4 * record
+        ? std::max<size_t>(2, (slot - sizeof(value_t)) / (2 * record) - 1)
+        : 2;
+    detail::io_worker_t reads;
+
+    while (!spills.empty()) {
+        const size_t k = std::min(fanin, spills.size());
+        const bool last = k == spills.size();
+        const size_t block = budget / (2 * record * (k + 1) + sizeof(value_t));
+
+        if (block == 0)
+            throw std::invalid_argument("memory budget is too small to merge two runs");
+
+        std::vector<std::unique_ptr<detail::run_reader_t<value_t>>> readers;
+        std::vector<detail::run_range_t<value_t>> ranges;
+
+        for (size_t i = 0; i < k; ++i) {
+            readers.push_back(std::make_unique<detail::run_reader_t<value_t>>(spills[i], reads, block));
+            ranges.push_back({readers.back().get()});
+        }
+
+        if (last) {
+            kway_merge<I...>(ranges, writer, nullptr, block);
+            break;
+        }
+
+        detail::spill_t merged (dir);
+        std::vector<std::byte> output[2];
+        detail::wait_guard_t guard (spilling);
+        size_t offset = 0, current = 0;
+
+        merged.count = kway_merge<I...>(ranges, [&](const value_t *batch, size_t count) {
+            if (spilling.valid()) spilling.get();
+
+            output[current].clear();
+            io::encode(output[current], batch, count);
+
+            spilling = writes.submit([&buffer = output[current], fd = merged.fd, offset]() {
+                io::write_at(fd, buffer.data(), buffer.size(), offset);
+            });
+
+            offset += count * record;
+            current ^= 1;
+        }, nullptr, block);
+
+        if (spilling.valid()) spilling.get();
+
+        readers.clear();
+        for (size_t i = 0; i < k; ++i) spills.pop_front();
+        spills.push_back(std::move(merged));
+    }
+
+    return total;
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,251 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The batched geometry kernels over sets of points.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/algorithm/top_k.hpp>
+#include <supertuple/container/soa.hpp>
+#include <supertuple/detail/parallel.hpp>
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/fold.hpp>
+#include <supertuple/operation/get.hpp>
+#include <supertuple/operation/zipwith.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Creates a structure-of-arrays type with repeated column types.
+     * @tparam T The type to be repeated as columns.
+     * @tparam I The columns' sequence indeces.
+     */
+    template <typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto soa_repeater(std::index_sequence<I...>) noexcept
+    -> soa_t<typename identity_t<T, I>::type...>;
+
+    /**
+     * The number of points in a tile, which is sized so that a tile of columns of
+     * points with a few dimensions fits comfortably in a core's first-level cache.
+     * @since 1.0
+     */
+    inline constexpr size_t geometry_tile = 1024;
+}
+
+/**
+ * A set of D-dimensional points, stored with one contiguous column per dimension.
+ * @tparam T The points' coordinates' type.
+ * @tparam D The points' dimensionality.
+ * @since 1.0
+ */
+template <typename T, size_t D>
+using points_t = decltype(detail::soa_repeater<T>(std::make_index_sequence<D>()));
+
+/**
+ * The result of a k-nearest neighbours search. The neighbours of each query point
+ * are stored contiguously, from the nearest one.
+ * @tparam T The distances' type.
+ * @since 1.0
+ */
+template <typename T>
+struct knn_t
+{
+    size_t k = 0;
+    std::vector<size_t> index;
+    std::vector<T> distance;
+};
+
+namespace detail
+{
+    /**
+     * Gathers a point from a set of points.
+     * @tparam T The points' coordinates' type.
+     * @tparam I The points' dimensions' sequence indeces.
+     * @param points The set of points to gather from.
+     * @param i The index of the point to be gathered.
+     * @return The point's coordinates.
+     */
+    template <typename ...T, size_t ...I>
+    inline auto point(const soa_t<T...>& points, size_t i, std::index_sequence<I...>)
+    {
+        return ntuple_t<std::common_type_t<T...>, sizeof...(T)>(points.template column<I>()[i]...);
+    }
+
+    /**
+     * Gathers pointers to the columns of a set of points.
+     * @tparam T The points' coordinates' type.
+     * @tparam I The points' dimensions' sequence indeces.
+     * @param points The set of points to gather from.
+     * @return The pointers to each dimension's column.
+     */
+    template <typename ...T, size_t ...I>
+    inline auto columns(const soa_t<T...>& points, std::index_sequence<I...>)
+    {
+        using element_t = std::common_type_t<T...>;
+        const element_t *data[] = {points.template column<I>().data()...};
+        return ntuple_t<const element_t*, sizeof...(T)>(data);
+    }
+
+    /**
+     * Computes the squared distances from a point to a run of points of a set. The
+     * per-dimension differences are combined by zipping the point with the set's
+     * columns and folding the squares, so that the same kernel serves any number
+     * of dimensions; on vector-capable targets, each step covers a vector of points.
+     * @tparam T The points' coordinates' type.
+     * @tparam D The points' dimensionality.
+     * @param p The point to compute the distances from.
+     * @param cols The pointers to the set's columns.
+     * @param first The index of the run's first point.
+     * @param last The index of the run's end.
+     * @param out The squared distances of each point in the run.
+     */
+    template <typename T, size_t D>
+    inline void distances(
+        const ntuple_t<T, D>& p, const ntuple_t<const T*, D>& cols
+      , size_t first, size_t last, T *out
+    ) {
+        auto add = [](const auto& x, const auto& y) { return x + y; };
+        size_t j = first;
+
+      #if defined(SUPERTUPLE_SIMD_ENABLED)
+        if constexpr (std::is_floating_point_v<T> && simd::vectorizable_v<T>) {
+            using vector_t = simd::vector_t<T>;
+            constexpr size_t lanes = sizeof(vector_t) / sizeof(T);
+
+            for (; j + lanes <= last; j += lanes) {
+                auto square = [j](const T& x, const T *col) {
+                    const vector_t d = simd::load<vector_t>(col + j) - x;
+                    return d * d;
+                };
+
+                simd::store(out + (j - first), (vector_t) operation::foldl(operation::zipwith(p, cols, square), add));
+            }
+        }
+      #endif
+
+        for (; j < last; ++j) {
+            auto square = [j](const T& x, const T *col) { const T d = col[j] - x; return d * d; };
+            out[j - first] = operation::foldl(operation::zipwith(p, cols, square), add);
+        }
+    }
+}
+
+/**
+ * Computes the matrix of Euclidean distances between two sets of points. The matrix
+ * is computed in tiles of the second set, so that each tile stays in cache while all
+ * points of a block of the first set are compared to it, and blocks are spread over
+ * threads.
+ * @tparam T The points' coordinates' types.
+ * @param a The first set of points, whose points are the matrix's rows.
+ * @param b The second set of points, whose points are the matrix's columns.
+ * @param out The row-major matrix with room for all pairs of points.
+ * @param squared Must the distances be left squared, skipping their roots?
+ * @param threads The number of threads to compute the matrix with.
+ */
+template <typename ...T>
+inline void distance_matrix(
+    const soa_t<T...>& a, const soa_t<T...>& b
+  , std::common_type_t<T...> *out, bool squared = false
+  , size_t threads = 1
+) {
+    using element_t = std::common_type_t<T...>;
+    static_assert((std::is_same_v<T, element_t> && ...), "points must have coordinates of the same type");
+
+    constexpr size_t D = sizeof...(T);
+    constexpr size_t block = 64;
+
+    const size_t na = a.size(), nb = b.size();
+    const auto cols = detail::columns(b, std::make_index_sequence<D>());
+
+    detail::parallel::each(threads, (na + block - 1) / block, [&](size_t blk, size_t) {
+        const size_t ilast = std::min(na, (blk + 1) * block);
+
+        for (size_t first = 0; first < nb; first += detail::geometry_tile) {
+            const size_t last = std::min(nb, first + detail::geometry_tile);
+
+            for (size_t i = blk * block; i < ilast; ++i) {
+                element_t *row = out + i * nb;
+                detail::distances(detail::point(a, i, std::make_index_sequence<D>()), cols, first, last, row + first);
+                if (!squared) for (size_t j = first; j < last; ++j) row[j] = std::sqrt(row[j]);
+            }
+        }
+    });
+}
+
+/**
+ * Finds the k nearest neighbours of each query point by brute force. The distances
+ * from a query to a tile of points are computed at once, and then filtered through
+ * a bounded heap, which rejects most of the points with a single comparison.
+ * @tparam T The points' coordinates' types.
+ * @param queries The set of query points.
+ * @param points The set of points to search the neighbours in.
+ * @param k The number of neighbours to find for each query.
+ * @param threads The number of threads to search with.
+ * @return The neighbours of each query and their Euclidean distances.
+ */
+template <typename ...T>
+inline auto knn(
+    const soa_t<T...>& queries, const soa_t<T...>& points
+  , size_t k, size_t threads = 1
+) -> knn_t<std::common_type_t<T...>>
+{
+    using element_t = std::common_type_t<T...>;
+    static_assert((std::is_same_v<T, element_t> && ...), "points must have coordinates of the same type");
+
+    constexpr size_t D = sizeof...(T);
+
+    knn_t<element_t> result;
+    result.k = std::min(k, points.size());
+    result.index.resize(queries.size() * result.k);
+    result.distance.resize(queries.size() * result.k);
+
+    if (result.k == 0)
+        return result;
+
+    const size_t n = points.size();
+    const auto cols = detail::columns(points, std::make_index_sequence<D>());
+    std::vector<std::vector<element_t>> buffers (std::max<size_t>(1, threads));
+
+    detail::parallel::each(threads, queries.size(), [&](size_t q, size_t id) {
+        auto& buffer = buffers[id];
+        buffer.resize(detail::geometry_tile);
+
+        const auto p = detail::point(queries, q, std::make_index_sequence<D>());
+        detail::top_heap_t<element_t, size_t, std::less<>> heap (result.k, std::less<>());
+
+        for (size_t first = 0; first < n; first += detail::geometry_tile) {
+            const size_t last = std::min(n, first + detail::geometry_tile);
+            detail::distances(p, cols, first, last, buffer.data());
+
+            size_t j = first;
+            for (; j < last && !heap.full(); ++j) heap.push(buffer[j - first], j);
+            for (; j < last; ++j) if (heap.admits(buffer[j - first])) heap.replace(buffer[j - first], j);
+        }
+
+        const auto entries = std::move(heap).release();
+
+        for (size_t i = 0; i < entries.size(); ++i) {
+            result.index[q * result.k + i] = entries[i].payload;
+            result.distance[q * result.k + i] = std::sqrt(entries[i].key);
+        }
+    }, 16);
+
+    return result;
+}
+
+SUPERTUPLE_END_NAMESPACE
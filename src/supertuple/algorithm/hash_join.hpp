@@ -0,0 +1,248 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The partitioned parallel hash join of tuple relations.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/algorithm/keys.hpp>
+#include <supertuple/detail/parallel.hpp>
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/concat.hpp>
+#include <supertuple/operation/hash.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+/**
+ * The statistics of a hash join's partitioning, which allow skewed keys or badly
+ * sized partitions to be diagnosed.
+ * @since 1.0
+ */
+struct hash_join_stats_t
+{
+    size_t threads = 0;
+    size_t partitions = 0;
+    size_t matches = 0;
+    size_t largest = 0;
+    std::vector<size_t> build;
+    std::vector<size_t> probe;
+};
+
+namespace detail
+{
+    /**
+     * The number of build rows aimed for each partition, so that a partition and
+     * its hash table fit comfortably within a core's private cache.
+     * @since 1.0
+     */
+    inline constexpr size_t join_partition_rows = 8192;
+
+    /**
+     * A partitioned row of a relation, along with its key's hash.
+     * @tparam T The relation's tuple type.
+     * @since 1.0
+     */
+    template <typename T>
+    struct join_entry_t
+    {
+        uint64_t hash;
+        const T *row;
+    };
+
+    /**
+     * Finds the smallest power of two not lesser than a value.
+     * @param value The value to be rounded up.
+     * @return The number of bits of the rounded up power of two.
+     */
+    inline size_t log2ceil(size_t value) noexcept
+    {
+        size_t bits = 0;
+        while (((size_t) 1 << bits) < value) ++bits;
+        return bits;
+    }
+
+    /**
+     * Radix-partitions a relation by the high bits of its rows' key hashes. Each thread
+     * first counts its chunk's rows per partition and then scatters them to disjoint
+     * slices of the output, so that no synchronization is needed between threads.
+     * @tparam K The relation's key selection type.
+     * @tparam T The relation's tuple type.
+     * @param data The relation's rows.
+     * @param n The number of rows in the relation.
+     * @param bits The number of hash bits used to pick a row's partition.
+     * @param threads The number of threads to partition the relation with.
+     * @param offsets The offsets of each partition within the output.
+     * @return The partitioned rows.
+     */
+    template <typename K, typename T>
+    inline std::vector<join_entry_t<T>> partition(
+        const T *data, size_t n, size_t bits, size_t threads
+      , std::vector<size_t>& offsets
+    ) {
+        const size_t partitions = (size_t) 1 << bits;
+        const size_t chunk = (n + threads - 1) / threads;
+        auto select = [bits](uint64_t hash) { return bits ? (size_t) (hash >> (64 - bits)) : 0; };
+
+        std::vector<uint64_t> hashes (n);
+        std::vector<std::vector<size_t>> cursor (threads, std::vector<size_t>(partitions, 0));
+
+        detail::parallel::run(threads, [&](size_t id) {
+            for (size_t i = id * chunk, last = std::min(n, i + chunk); i < last; ++i) {
+                hashes[i] = operation::hash(K::tie(data[i]));
+                ++cursor[id][select(hashes[i])];
+            }
+        });
+
+        offsets.assign(partitions + 1, 0);
+
+        for (size_t p = 0, total = 0; p < partitions; ++p) {
+            offsets[p] = total;
+            for (size_t id = 0; id < threads; ++id) {
+                const size_t count = cursor[id][p];
+                cursor[id][p] = total;
+                total += count;
+            }
+        }
+
+        offsets[partitions] = n;
+        std::vector<join_entry_t<T>> result (n);
+
+        detail::parallel::run(threads, [&](size_t id) {
+            for (size_t i = id * chunk, last = std::min(n, i + chunk); i < last; ++i)
+                result[cursor[id][select(hashes[i])]++] = { hashes[i], &data[i] };
+        });
+
+        return result;
+    }
+}
+
+/**
+ * Joins two relations of tuples by the equality of their keys. Both relations are
+ * radix-partitioned by their key hashes into partitions sized for the cache, and each
+ * partition pair is then joined independently by whichever thread takes it, through
+ * an open-addressing table built over its build-side rows. As partitions are owned
+ * by a single thread, neither building nor probing requires any lock. The emitter
+ * is invoked concurrently with each joined row and the index of the emitting worker,
+ * which may be used to collect rows into per-worker buffers.
+ * @tparam KA The build relation's key selection type.
+ * @tparam KB The probe relation's key selection type.
+ * @tparam A The build relation type.
+ * @tparam B The probe relation type.
+ * @tparam F The emitter functor type.
+ * @param build The relation to build the hash tables with, usually the smallest one.
+ * @param probe The relation to probe the hash tables with.
+ * @param emit The emitter of rows referencing each matching pair of tuples.
+ * @param threads The number of threads to join the relations with.
+ * @return The join's partitioning statistics.
+ */
+template <typename KA, typename KB, typename A, typename B, typename F>
+inline hash_join_stats_t hash_join(
+    const A& build, const B& probe, F&& emit
+  , size_t threads = detail::parallel::concurrency()
+) {
+    using left_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::data(build))>>;
+    using right_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::data(probe))>>;
+
+    static_assert(
+        std::is_same_v<typename KA::template value_t<left_t>, typename KB::template value_t<right_t>>
+      , "joined keys must have the same element types to be hashed equally");
+
+    const size_t nb = std::size(build);
+    const size_t np = std::size(probe);
+
+    hash_join_stats_t stats;
+    stats.threads = std::max<size_t>(1, threads);
+
+    const size_t bits = std::min<size_t>(12, std::max(
+        detail::log2ceil(nb / detail::join_partition_rows)
+      , stats.threads > 1 ? detail::log2ceil(stats.threads * 4) : 0));
+
+    std::vector<size_t> bo, po;
+    const auto bp = detail::partition<KA>(std::data(build), nb, bits, stats.threads, bo);
+    const auto pp = detail::partition<KB>(std::data(probe), np, bits, stats.threads, po);
+
+    stats.partitions = (size_t) 1 << bits;
+    stats.build.resize(stats.partitions);
+    stats.probe.resize(stats.partitions);
+
+    for (size_t p = 0; p < stats.partitions; ++p) {
+        stats.build[p] = bo[p + 1] - bo[p];
+        stats.probe[p] = po[p + 1] - po[p];
+        stats.largest = std::max(stats.largest, stats.build[p]);
+    }
+
+    std::vector<std::vector<uint32_t>> tables (stats.threads);
+    std::vector<size_t> matches (stats.threads * 8, 0);
+
+    detail::parallel::each(stats.threads, stats.partitions, [&](size_t p, size_t id) {
+        const size_t nbp = stats.build[p];
+        const size_t npp = stats.probe[p];
+        if (nbp == 0 || npp == 0) return;
+
+        const auto *bs = &bp[bo[p]];
+        const auto *ps = &pp[po[p]];
+
+        const size_t mask = ((size_t) 1 << detail::log2ceil(nbp * 2)) - 1;
+        auto& table = tables[id];
+        table.assign(mask + 1, 0);
+
+        for (size_t i = 0; i < nbp; ++i) {
+            size_t slot = bs[i].hash & mask;
+            while (table[slot] != 0) slot = (slot + 1) & mask;
+            table[slot] = (uint32_t) i + 1;
+        }
+
+        size_t local = 0;
+
+        for (size_t j = 0; j < npp; ++j) {
+            for (size_t slot = ps[j].hash & mask; table[slot] != 0; slot = (slot + 1) & mask) {
+                const auto& entry = bs[table[slot] - 1];
+
+                if (entry.hash == ps[j].hash && KA::template compare<KB>(*entry.row, *ps[j].row) == 0) {
+                    detail::invoke(emit, operation::concat(detail::cref(*entry.row), detail::cref(*ps[j].row)), id);
+                    ++local;
+                }
+            }
+        }
+
+        matches[id * 8] += local;
+    });
+
+    for (size_t id = 0; id < stats.threads; ++id)
+        stats.matches += matches[id * 8];
+
+    return stats;
+}
+
+/**
+ * Joins two relations of tuples by the equality of the elements at the same indeces.
+ * @tparam I The indeces of the key elements in both relations.
+ * @tparam A The build relation type.
+ * @tparam B The probe relation type.
+ * @tparam F The emitter functor type.
+ * @param build The relation to build the hash tables with, usually the smallest one.
+ * @param probe The relation to probe the hash tables with.
+ * @param emit The emitter of rows referencing each matching pair of tuples.
+ * @param threads The number of threads to join the relations with.
+ * @return The join's partitioning statistics.
+ */
+template <size_t ...I, typename A, typename B, typename F>
+inline hash_join_stats_t hash_join(
+    const A& build, const B& probe, F&& emit
+  , size_t threads = detail::parallel::concurrency()
+) {
+    return hash_join<keys_t<I...>, keys_t<I...>>(build, probe, emit, threads);
+}
+
+SUPERTUPLE_END_NAMESPACE
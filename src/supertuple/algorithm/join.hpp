@@ -0,0 +1,172 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The sort-merge join of sorted tuple sequences.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/algorithm/keys.hpp>
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/concat.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+/**
+ * The kinds of joins between two tuple sequences.
+ * @since 1.0
+ */
+enum class join_t
+{
+    inner = 0
+  , left
+  , outer
+};
+
+/**
+ * The forms in which joined rows can be emitted. Reference rows gather references
+ * to the elements of both joined tuples, while concatenated rows own copies of them.
+ * @since 1.0
+ */
+enum class join_output_t
+{
+    reference = 0
+  , concat
+};
+
+/**
+ * Informs which sides of a join have contributed to an emitted row. The elements of
+ * a side that has not contributed are all value-initialized.
+ * @since 1.0
+ */
+enum class join_match_t
+{
+    both = 0
+  , left
+  , right
+};
+
+namespace detail
+{
+    /**
+     * Combines a pair of joined tuples into an output row and emits it. The match
+     * is only informed to the emitter on outer joins, as inner joins always match.
+     * @tparam J The kind of join being performed.
+     * @tparam O The form of the rows to be emitted.
+     * @tparam F The emitter functor type.
+     * @tparam T The left tuple type.
+     * @tparam U The right tuple type.
+     * @param emit The emitter of output rows.
+     * @param a The left tuple of the row.
+     * @param b The right tuple of the row.
+     * @param match The sides which contributed to the row.
+     */
+    template <join_t J, join_output_t O, typename F, typename T, typename U>
+    inline void emit(const F& emit, const T& a, const U& b, join_match_t match)
+    {
+        auto row = [&]() {
+            if constexpr (O == join_output_t::reference)
+                return operation::concat(detail::cref(a), detail::cref(b));
+            else return operation::concat(a, b);
+        };
+
+        if constexpr (J == join_t::inner) detail::invoke(emit, row());
+        else detail::invoke(emit, row(), match);
+    }
+
+    /**
+     * Advances an iterator past the run of elements with a key equivalent to the one
+     * of the element it points to.
+     * @tparam K The key selection type.
+     * @tparam I The iterator type.
+     * @param first The first element of the run.
+     * @param last The end of the sequence.
+     * @return The end of the run.
+     */
+    template <typename K, typename I>
+    inline I run(I first, I last)
+    {
+        I next = first;
+        while (++next != last && K::template compare<K>(*first, *next) == 0);
+        return next;
+    }
+}
+
+/**
+ * Joins two sequences of tuples sorted by their keys. Only the key elements of each
+ * side are compared, and runs of equivalent keys on both sides are joined by batched
+ * cross products, such that every pair in a run is emitted exactly once. The emitter
+ * is invoked with each joined row and, on left and full outer joins, with the sides
+ * that have contributed to it.
+ * @tparam KA The left sequence's key selection type.
+ * @tparam KB The right sequence's key selection type.
+ * @tparam J The kind of join to be performed.
+ * @tparam O The form of the rows to be emitted.
+ * @tparam A The left sequence type.
+ * @tparam B The right sequence type.
+ * @tparam F The emitter functor type.
+ * @param a The left sequence, sorted by its key.
+ * @param b The right sequence, sorted by its key.
+ * @param emit The emitter of output rows.
+ * @return The number of rows emitted.
+ */
+template <
+    typename KA, typename KB = KA, join_t J = join_t::inner
+  , join_output_t O = join_output_t::reference
+  , typename A, typename B, typename F>
+inline size_t merge_join(const A& a, const B& b, F&& emit)
+{
+    using std::begin, std::end;
+    using left_t = typename std::iterator_traits<decltype(begin(a))>::value_type;
+    using right_t = typename std::iterator_traits<decltype(begin(b))>::value_type;
+
+    auto ia = begin(a), ea = end(a);
+    auto ib = begin(b), eb = end(b);
+    size_t total = 0;
+
+    while (ia != ea && ib != eb) {
+        const int result = KA::template compare<KB>(*ia, *ib);
+
+        if (result < 0) {
+            if constexpr (J != join_t::inner) {
+                detail::emit<J, O>(emit, *ia, detail::null<right_t>(), join_match_t::left);
+                ++total;
+            }
+            ++ia;
+        } else if (result > 0) {
+            if constexpr (J == join_t::outer) {
+                detail::emit<J, O>(emit, detail::null<left_t>(), *ib, join_match_t::right);
+                ++total;
+            }
+            ++ib;
+        } else {
+            const auto ja = detail::run<KA>(ia, ea);
+            const auto jb = detail::run<KB>(ib, eb);
+
+            for (; ia != ja; ++ia)
+                for (auto xb = ib; xb != jb; ++xb, ++total)
+                    detail::emit<J, O>(emit, *ia, *xb, join_match_t::both);
+
+            ib = jb;
+        }
+    }
+
+    if constexpr (J != join_t::inner)
+        for (; ia != ea; ++ia, ++total)
+            detail::emit<J, O>(emit, *ia, detail::null<right_t>(), join_match_t::left);
+
+    if constexpr (J == join_t::outer)
+        for (; ib != eb; ++ib, ++total)
+            detail::emit<J, O>(emit, detail::null<left_t>(), *ib, join_match_t::right);
+
+    return total;
+}
+
+SUPERTUPLE_END_NAMESPACE
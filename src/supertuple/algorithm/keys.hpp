@@ -0,0 +1,174 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The selection of tuple elements used as keys by algorithms.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Checks whether a list of key element types can be normalized into a single
+     * unsigned integer, whose order is the lexicographical order of the elements.
+     * @tparam T The key elements' types.
+     * @since 1.0
+     */
+    template <typename ...T>
+    inline constexpr bool normalizable_v =
+        ((std::is_integral_v<T> && !std::is_same_v<T, bool>) && ...)
+        && (sizeof(T) + ... + 0) <= sizeof(uint64_t);
+
+    /**
+     * Appends a key element to a normalized key. Signed elements have their sign bit
+     * flipped, so that the order of their unsigned representation is preserved.
+     * @tparam T The key element's type.
+     * @param key The normalized key built so far.
+     * @param x The key element to be appended.
+     * @return The normalized key with the element appended.
+     */
+    template <typename T>
+    SUPERTUPLE_CONSTEXPR uint64_t normalize(uint64_t key, const T& x) noexcept
+    {
+        using U = std::make_unsigned_t<T>;
+        U u = (U) x;
+
+        if constexpr (std::is_signed_v<T>)
+            u ^= (U) (U(1) << (sizeof(T) * 8 - 1));
+
+        if constexpr (sizeof(T) < sizeof(uint64_t))
+            return (key << (sizeof(T) * 8)) | (uint64_t) u;
+        else return (uint64_t) u;
+    }
+}
+
+/**
+ * Selects, by their compile-time indeces, the elements of a tuple that compose its
+ * key for algorithms such as joins and merges. Keys are compared and hashed through
+ * references to the selected elements, so that no element is ever copied.
+ * @tparam I The indeces of the key elements in the tuple.
+ * @since 1.0
+ */
+template <size_t ...I>
+struct keys_t
+{
+    static_assert(sizeof...(I) > 0, "keys must select at least one tuple element");
+
+    static constexpr size_t count = sizeof...(I);
+
+    /**
+     * The type of a tuple's key, as references to the selected elements.
+     * @tparam T The tuple type to select the key from.
+     * @since 1.0
+     */
+    template <typename T>
+    using reference_t = tuple_t<const tuple_element_t<typename T::base_tuple_t, I>&...>;
+
+    /**
+     * The type of a tuple's key, as copies of the selected elements.
+     * @tparam T The tuple type to select the key from.
+     * @since 1.0
+     */
+    template <typename T>
+    using value_t = tuple_t<tuple_element_t<typename T::base_tuple_t, I>...>;
+
+    /**
+     * Gathers references to a tuple's key elements.
+     * @tparam T The tuple type to select the key from.
+     * @param t The tuple to select the key from.
+     * @return The tuple of references to the key elements.
+     */
+    template <typename T>
+    SUPERTUPLE_CONSTEXPR static reference_t<T> tie(const T& t) noexcept
+    {
+        return reference_t<T>(operation::get<I>(t)...);
+    }
+
+    /**
+     * Compares the key of a tuple with the key of another tuple.
+     * @tparam J The other tuple's key selection type.
+     * @tparam T The first tuple type.
+     * @tparam U The other tuple type.
+     * @param a The first tuple to be compared.
+     * @param b The other tuple to be compared.
+     * @return A negative, zero or positive value whether the first key is lesser,
+     * equivalent or greater than the other one.
+     */
+    template <typename J, typename T, typename U>
+    SUPERTUPLE_CONSTEXPR static int compare(const T& a, const U& b) noexcept
+    {
+        static_assert(J::count == count, "compared keys must have the same number of elements");
+        return detail::compare(tie(a), J::tie(b), std::make_index_sequence<count>());
+    }
+
+    /**
+     * Informs whether the keys of a tuple type can be normalized, that is, whether
+     * they are all integers which fit together in a single machine word.
+     * @tparam T The tuple type to select the key from.
+     * @since 1.0
+     */
+    template <typename T>
+    static constexpr bool normalizable = detail::normalizable_v<tuple_element_t<typename T::base_tuple_t, I>...>;
+
+    /**
+     * Normalizes a tuple's key into an unsigned integer, in a memcmp-like fashion:
+     * the key elements are laid out from the most significant bits, so that keys
+     * can be compared with a single integer comparison and sorted by their bytes.
+     * @tparam T The tuple type to select the key from.
+     * @param t The tuple to normalize the key of.
+     * @return The tuple's normalized key.
+     */
+    template <typename T>
+    SUPERTUPLE_CONSTEXPR static uint64_t normalize(const T& t) noexcept
+    {
+        static_assert(normalizable<T>, "only keys of integers fitting a machine word can be normalized");
+        uint64_t key = 0;
+        ((key = detail::normalize(key, operation::get<I>(t))), ...);
+        return key;
+    }
+};
+
+namespace detail
+{
+    /**
+     * Gathers const-qualified references to all elements of a tuple.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to gather the references from.
+     * @return The tuple of references to the tuple's elements.
+     */
+    template <size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR auto cref(
+        const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) noexcept -> tuple_t<const T&...>
+    {
+        return tuple_t<const T&...>(operation::get<I>(t)...);
+    }
+
+    /**
+     * Produces a shared value-initialized instance of a type, which stands for the
+     * missing side of unmatched rows in outer algorithms.
+     * @tparam T The instance's type.
+     * @return The shared value-initialized instance.
+     */
+    template <typename T>
+    inline const T& null() noexcept
+    {
+        static const T instance {};
+        return instance;
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
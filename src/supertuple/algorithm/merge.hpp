@@ -0,0 +1,239 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The k-way merge of sorted tuple sequences.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/algorithm/keys.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * A tournament tree of losers over the heads of k sorted sequences. Each inner
+     * node keeps the sequence that lost the match played at it, while the overall
+     * winner is kept apart. Thus, when the winner's sequence advances, its new head
+     * only has to replay the matches on the path to the root, against the losers
+     * stored along it, with one comparison per level and no sibling lookups.
+     * @tparam K The key selection type.
+     * @tparam I The sequences' iterator type.
+     * @since 1.0
+     */
+    template <typename K, typename I>
+    class loser_tree_t
+    {
+        public:
+            typedef typename std::iterator_traits<I>::value_type value_t;
+
+        private:
+            /**
+             * Normalized keys are cached for every sequence's head, so that matches
+             * between integer keys are played with a single integer comparison.
+             * @since 1.0
+             */
+            static constexpr bool normalized = K::template normalizable<value_t>;
+
+            struct head_t { I first, last; uint64_t key = 0; };
+
+        private:
+            std::vector<head_t> m_heads;
+            std::vector<size_t> m_losers;
+            size_t m_winner = 0;
+
+        public:
+            /**
+             * Plays the initial tournament among the given sequences.
+             * @param ranges The pairs of iterators delimiting each sequence.
+             */
+            inline explicit loser_tree_t(std::vector<std::pair<I, I>> ranges)
+              : m_losers (ranges.size())
+            {
+                const size_t k = ranges.size();
+                std::vector<size_t> winners (2 * k);
+
+                m_heads.reserve(k);
+
+                for (size_t i = 0; i < k; ++i) {
+                    m_heads.push_back(head_t {ranges[i].first, ranges[i].second});
+                    winners[k + i] = i;
+                    cache(i);
+                }
+
+                for (size_t n = k > 0 ? k - 1 : 0; n > 0; --n) {
+                    const size_t a = winners[2 * n], b = winners[2 * n + 1];
+                    const bool first = beats(a, b);
+                    winners[n] = first ? a : b;
+                    m_losers[n] = first ? b : a;
+                }
+
+                m_winner = k > 1 ? winners[1] : 0;
+            }
+
+            /**
+             * Informs whether all sequences have been exhausted.
+             * @return Are all sequences empty?
+             */
+            inline bool empty() const noexcept
+            {
+                return m_heads.empty() || m_heads[m_winner].first == m_heads[m_winner].last;
+            }
+
+            /**
+             * Retrieves the smallest head among all sequences.
+             * @return The winning sequence's head.
+             */
+            inline const value_t& top() const noexcept
+            {
+                return *m_heads[m_winner].first;
+            }
+
+            /**
+             * Retrieves the normalized key of the smallest head among all sequences.
+             * @return The winning head's normalized key.
+             */
+            inline uint64_t key() const noexcept
+            {
+                return m_heads[m_winner].key;
+            }
+
+            /**
+             * Advances the winning sequence and replays its path to the root.
+             */
+            inline void pop()
+            {
+                size_t winner = m_winner;
+                ++m_heads[winner].first;
+                cache(winner);
+
+                for (size_t n = (winner + m_heads.size()) / 2; n > 0; n /= 2)
+                    if (beats(m_losers[n], winner))
+                        std::swap(m_losers[n], winner);
+
+                m_winner = winner;
+            }
+
+        private:
+            /**
+             * Caches the normalized key of a sequence's head.
+             * @param i The sequence to cache the head key of.
+             */
+            inline void cache(size_t i)
+            {
+                if constexpr (normalized) {
+                    head_t& head = m_heads[i];
+                    if (head.first != head.last) head.key = K::normalize(*head.first);
+                }
+            }
+
+            /**
+             * Plays a match between the heads of two sequences. Exhausted sequences
+             * lose against any other, and ties are won by the earlier sequence, so
+             * that equivalent keys are produced in the order of their sequences.
+             * @param a The first sequence in the match.
+             * @param b The second sequence in the match.
+             * @return Does the first sequence win the match?
+             */
+            inline bool beats(size_t a, size_t b) const
+            {
+                const head_t& x = m_heads[a];
+                const head_t& y = m_heads[b];
+
+                if (x.first == x.last) return false;
+                if (y.first == y.last) return true;
+
+                if constexpr (normalized) {
+                    return x.key != y.key ? x.key < y.key : a < b;
+                } else {
+                    const int result = K::template compare<K>(*x.first, *y.first);
+                    return result != 0 ? result < 0 : a < b;
+                }
+            }
+    };
+}
+
+/**
+ * Merges any number of sequences of tuples sorted by their keys into a single sorted
+ * sequence. The heads of the sequences compete in a loser tree, and integer keys
+ * which fit a machine word are normalized, so that each step costs a logarithmic
+ * number of integer comparisons. Merged tuples are copied into batches, which are
+ * handed to the sink as contiguous spans. Tuples with equivalent keys are produced
+ * in the order of their sequences; if a resolver is given, they are collapsed into
+ * a single tuple instead, by folding each later tuple into the first one, which
+ * for instance allows last-writer-wins compaction by simple assignment.
+ * @tparam I The indeces of the key elements in the tuples.
+ * @tparam R The sequences' container type.
+ * @tparam S The sink functor type.
+ * @tparam F The duplicate resolver functor type.
+ * @param runs The sequences to be merged, each one sorted by its key.
+ * @param sink The sink of merged batches, invoked with a pointer and a count.
+ * @param resolve The resolver of equivalent keys, invoked with the mutable resulting
+ * tuple and the next equivalent one, or null to keep all duplicated keys.
+ * @param batch The maximum number of tuples in each batch.
+ * @return The number of tuples produced.
+ */
+template <size_t ...I, typename R, typename S, typename F = std::nullptr_t>
+inline size_t kway_merge(const R& runs, S&& sink, F&& resolve = nullptr, size_t batch = 1024)
+{
+    using std::begin, std::end;
+    using iterator_t = decltype(begin(*begin(runs)));
+    using tree_t = detail::loser_tree_t<keys_t<I...>, iterator_t>;
+    using value_t = typename tree_t::value_t;
+
+    constexpr bool resolving = !std::is_null_pointer_v<std::decay_t<F>>;
+    constexpr bool normalized = keys_t<I...>::template normalizable<value_t>;
+
+    std::vector<std::pair<iterator_t, iterator_t>> ranges;
+    for (const auto& run : runs) ranges.emplace_back(begin(run), end(run));
+
+    tree_t tree (std::move(ranges));
+    std::vector<value_t> buffer;
+    size_t total = 0;
+
+    batch = batch > 0 ? batch : 1;
+    buffer.reserve(batch);
+
+    auto flush = [&]() {
+        if (buffer.empty()) return;
+        sink((const value_t*) buffer.data(), buffer.size());
+        total += buffer.size();
+        buffer.clear();
+    };
+
+    for (uint64_t last = 0; !tree.empty(); tree.pop()) {
+        if constexpr (resolving) {
+            const bool equal = !buffer.empty() && (normalized
+                ? tree.key() == last
+                : keys_t<I...>::template compare<keys_t<I...>>(buffer.back(), tree.top()) == 0);
+
+            if (equal) {
+                resolve(buffer.back(), tree.top());
+                continue;
+            }
+
+            // The batch is only flushed when a new key is about to be appended, so the
+            // tuple at its back is always the one receiving the equivalent keys.
+            if constexpr (normalized) last = tree.key();
+        }
+
+        if (buffer.size() == batch) flush();
+        buffer.push_back(tree.top());
+    }
+
+    flush();
+    return total;
+}
+
+SUPERTUPLE_END_NAMESPACE
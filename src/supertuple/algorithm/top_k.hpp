@@ -0,0 +1,282 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The top-k selection of tuples by a projected key element.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/container/soa.hpp>
+#include <supertuple/detail/parallel.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * A heap bounded to the k best ranked keys offered to it. The worst ranked of
+     * the kept keys sits on the heap's top and acts as the threshold a new key must
+     * beat to be admitted, so that rejecting a key costs a single comparison.
+     * @tparam K The ranked key type.
+     * @tparam P The payload type kept along with each key.
+     * @tparam C The key ranking comparator type.
+     * @since 1.0
+     */
+    template <typename K, typename P, typename C>
+    class top_heap_t
+    {
+        public:
+            /**
+             * An entry of the heap, with a copy of its key to avoid indirections.
+             * @since 1.0
+             */
+            struct entry_t
+            {
+                K key;
+                P payload;
+            };
+
+        private:
+            std::vector<entry_t> m_heap;
+            size_t m_capacity;
+            C m_cmp;
+
+        public:
+            /**
+             * Creates a new heap bounded to the given number of entries.
+             * @param k The maximum number of entries in the heap.
+             * @param cmp The comparator ranking keys.
+             */
+            inline top_heap_t(size_t k, const C& cmp)
+              : m_capacity (k)
+              , m_cmp (cmp)
+            {
+                m_heap.reserve(k);
+            }
+
+            /**
+             * Informs whether the heap is full, and thus has a threshold.
+             * @return Is the heap full?
+             */
+            inline bool full() const noexcept
+            {
+                return m_heap.size() >= m_capacity;
+            }
+
+            /**
+             * Retrieves the worst ranked key kept by a full heap.
+             * @return The key that new keys must beat.
+             */
+            inline const K& threshold() const noexcept
+            {
+                return m_heap.front().key;
+            }
+
+            /**
+             * Checks whether a key beats the threshold of a full heap.
+             * @param key The key to be checked.
+             * @return Must the key be admitted?
+             */
+            inline bool admits(const K& key) const
+            {
+                return m_cmp(key, threshold());
+            }
+
+            /**
+             * Pushes an entry into a heap that is not yet full.
+             * @param key The entry's key.
+             * @param payload The entry's payload.
+             */
+            inline void push(const K& key, const P& payload)
+            {
+                m_heap.push_back({key, payload});
+                if (full()) std::make_heap(m_heap.begin(), m_heap.end(), order());
+            }
+
+            /**
+             * Replaces the heap's threshold by an admitted entry. The evicted entry is
+             * assigned to, so that its payload's storage may be reused.
+             * @param key The entry's key.
+             * @param payload The entry's payload.
+             */
+            inline void replace(const K& key, const P& payload)
+            {
+                std::pop_heap(m_heap.begin(), m_heap.end(), order());
+                m_heap.back().key = key;
+                m_heap.back().payload = payload;
+                std::push_heap(m_heap.begin(), m_heap.end(), order());
+            }
+
+            /**
+             * Offers an entry to the heap, admitting it if it ranks well enough. The
+             * key is tested first, so that the payload is only copied if admitted.
+             * @param key The entry's key.
+             * @param payload The entry's payload.
+             */
+            inline void offer(const K& key, const P& payload)
+            {
+                if (!full()) push(key, payload);
+                else if (admits(key)) replace(key, payload);
+            }
+
+            /**
+             * Releases the heap's entries ordered from the best ranked one.
+             * @return The heap's sorted entries.
+             */
+            inline std::vector<entry_t> release() &&
+            {
+                std::sort(m_heap.begin(), m_heap.end(), order());
+                return std::move(m_heap);
+            }
+
+        private:
+            /**
+             * Builds the comparator that orders the heap's entries by their keys.
+             * @return The entries comparator.
+             */
+            inline auto order() const
+            {
+                return [this](const entry_t& a, const entry_t& b) { return m_cmp(a.key, b.key); };
+            }
+    };
+
+    /**
+     * Selects the indeces of the k best ranked keys in a random-access sequence. The
+     * sequence is split into chunks, each one scanned by its own thread into its own
+     * heap, and the per-thread heaps are then merged into the final selection.
+     * @tparam K The ranked key type.
+     * @tparam F The key accessor functor type.
+     * @tparam C The key ranking comparator type.
+     * @param n The number of elements in the sequence.
+     * @param k The number of keys to be selected.
+     * @param key The accessor of an element's key by its index.
+     * @param cmp The comparator ranking keys.
+     * @param threads The number of threads to scan the sequence with.
+     * @return The selected entries, ordered from the best ranked one.
+     */
+    template <typename K, typename F, typename C>
+    inline auto top_k(size_t n, size_t k, const F& key, const C& cmp, size_t threads)
+    -> std::vector<typename top_heap_t<K, size_t, C>::entry_t>
+    {
+        using heap_t = top_heap_t<K, size_t, C>;
+
+        threads = std::max<size_t>(1, std::min(threads, n / std::max<size_t>(k, 1024)));
+        const size_t chunk = (n + threads - 1) / threads;
+        std::vector<heap_t> heaps (threads, heap_t(k, cmp));
+
+        detail::parallel::run(threads, [&](size_t id) {
+            auto& heap = heaps[id];
+            size_t i = id * chunk;
+            const size_t last = std::min(n, i + chunk);
+
+            for (; i < last && !heap.full(); ++i)
+                heap.push(key(i), i);
+
+            for (; i < last; ++i)
+                if (heap.admits(key(i))) heap.replace(key(i), i);
+        });
+
+        if (threads == 1)
+            return std::move(heaps[0]).release();
+
+        heap_t merged (k, cmp);
+
+        for (auto& heap : heaps)
+            for (auto& entry : std::move(heap).release())
+                merged.offer(entry.key, entry.payload);
+
+        return std::move(merged).release();
+    }
+}
+
+/**
+ * Selects the k tuples of a sequence with the best ranked elements at the given
+ * index. By default, tuples with the greatest elements are selected. Random-access
+ * sequences are scanned for indeces only, possibly in parallel, and the selected
+ * tuples are copied at the end; other sequences are scanned serially, keeping copies
+ * of the selected tuples as they go.
+ * @tparam I The index of the ranked key element.
+ * @tparam R The sequence type.
+ * @tparam C The key ranking comparator type.
+ * @param range The sequence of tuples to select from.
+ * @param k The number of tuples to be selected.
+ * @param cmp The comparator ranking keys, such that better keys come first.
+ * @param threads The number of threads to scan random-access sequences with.
+ * @return The selected tuples, ordered from the best ranked one.
+ */
+template <size_t I, typename R, typename C = std::greater<>>
+inline auto top_k(const R& range, size_t k, const C& cmp = C(), size_t threads = 1)
+{
+    using std::begin, std::end;
+    using iterator_t = decltype(begin(range));
+    using value_t = typename std::iterator_traits<iterator_t>::value_type;
+    using key_t = std::decay_t<tuple_element_t<typename value_t::base_tuple_t, I>>;
+
+    std::vector<value_t> result;
+    if (k == 0) return result;
+
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<iterator_t>::iterator_category>) {
+        const iterator_t first = begin(range);
+        auto key = [&](size_t i) -> const key_t& { return operation::get<I>(first[i]); };
+        auto entries = detail::top_k<key_t>((size_t) (end(range) - first), k, key, cmp, threads);
+
+        result.reserve(entries.size());
+        for (const auto& entry : entries) result.push_back(first[entry.payload]);
+    } else {
+        detail::top_heap_t<key_t, value_t, C> heap (k, cmp);
+
+        for (const auto& t : range)
+            heap.offer(operation::get<I>(t), t);
+
+        for (auto& entry : std::move(heap).release())
+            result.push_back(std::move(entry.payload));
+    }
+
+    return result;
+}
+
+/**
+ * Selects the k rows of a structure-of-arrays container with the best ranked elements
+ * at the given column. Only the key column is scanned, and the remaining columns are
+ * gathered for the selected rows alone.
+ * @tparam I The index of the ranked key column.
+ * @tparam T The container's column types.
+ * @tparam C The key ranking comparator type.
+ * @param soa The container to select from.
+ * @param k The number of rows to be selected.
+ * @param cmp The comparator ranking keys, such that better keys come first.
+ * @param threads The number of threads to scan the key column with.
+ * @return The selected rows, ordered from the best ranked one.
+ */
+template <size_t I, typename ...T, typename C = std::greater<>>
+inline auto top_k(const soa_t<T...>& soa, size_t k, const C& cmp = C(), size_t threads = 1)
+-> soa_t<T...>
+{
+    using key_t = tuple_element_t<tuple_t<T...>, I>;
+
+    soa_t<T...> result;
+    if (k == 0) return result;
+
+    const key_t *column = soa.template column<I>().data();
+    auto key = [column](size_t i) -> const key_t& { return column[i]; };
+    auto entries = detail::top_k<key_t>(soa.size(), k, key, cmp, threads);
+
+    result.reserve(entries.size());
+    for (const auto& entry : entries) result.push_back(soa[entry.payload]);
+
+    return result;
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,332 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The sliding-window aggregation over tuple streams.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * An aggregator of a queue of tuples, which are combined elementwise by a list
+     * of associative combiners. The queue is split into two stacks: new tuples are
+     * pushed onto the back stack, which keeps a running aggregate, while the front
+     * stack keeps the aggregates of each of its tuples up to the queue's back. Once
+     * the front is exhausted, the back is flipped into it, so that every operation
+     * runs in amortized constant time without ever needing to invert a combiner.
+     * @tparam T The aggregated tuple type.
+     * @tparam F The elementwise combiners types.
+     * @since 1.0
+     */
+    template <typename T, typename ...F>
+    class two_stack_t
+    {
+        static_assert(T::count == sizeof...(F), "there must be one combiner for each tuple element");
+
+        private:
+            typedef std::make_index_sequence<sizeof...(F)> indexer_t;
+
+        private:
+            T m_identity;
+            T m_back;
+            tuple_t<F...> m_combiners;
+            std::vector<T> m_front;
+            std::vector<T> m_values;
+
+        public:
+            /**
+             * Creates a new empty aggregator.
+             * @param identity The identity tuple of all combiners.
+             * @param combiners The elementwise combiners.
+             */
+            inline two_stack_t(const T& identity, const F&... combiners)
+              : m_identity (identity)
+              , m_back (identity)
+              , m_combiners (combiners...)
+            {}
+
+            /**
+             * Pushes a tuple onto the queue's back.
+             * @param value The tuple to be pushed.
+             */
+            inline void push(const T& value)
+            {
+                m_values.push_back(value);
+                m_back = combine(m_back, value, indexer_t());
+            }
+
+            /**
+             * Removes the tuple at the queue's front.
+             */
+            inline void pop()
+            {
+                if (m_front.empty()) flip();
+                m_front.pop_back();
+            }
+
+            /**
+             * Aggregates all tuples in the queue, from its front to its back.
+             * @return The queue's aggregate.
+             */
+            inline T query() const
+            {
+                return m_front.empty() ? m_back : combine(m_front.back(), m_back, indexer_t());
+            }
+
+            /**
+             * Informs the number of tuples in the queue.
+             * @return The queue's size.
+             */
+            inline size_t size() const noexcept
+            {
+                return m_front.size() + m_values.size();
+            }
+
+            /**
+             * Removes all tuples from the queue.
+             */
+            inline void clear() noexcept
+            {
+                m_front.clear();
+                m_values.clear();
+                m_back = m_identity;
+            }
+
+            /**
+             * Reserves memory for the given number of tuples in each stack.
+             * @param n The number of tuples to reserve memory for.
+             */
+            inline void reserve(size_t n)
+            {
+                m_front.reserve(n);
+                m_values.reserve(n);
+            }
+
+        private:
+            /**
+             * Flips the back stack into the front stack, computing the aggregates of
+             * each tuple up to the newest one.
+             */
+            inline void flip()
+            {
+                T aggregate = m_identity;
+
+                for (size_t i = m_values.size(); i-- > 0; ) {
+                    aggregate = combine(m_values[i], aggregate, indexer_t());
+                    m_front.push_back(aggregate);
+                }
+
+                m_values.clear();
+                m_back = m_identity;
+            }
+
+            /**
+             * Combines two tuples elementwise, the older one on the left.
+             * @tparam I The tuples' sequence indeces.
+             * @param a The older tuple to be combined.
+             * @param b The newer tuple to be combined.
+             * @return The combined tuple.
+             */
+            template <size_t ...I>
+            inline T combine(const T& a, const T& b, std::index_sequence<I...>) const
+            {
+                return T(detail::invoke(operation::get<I>(m_combiners), operation::get<I>(a), operation::get<I>(b))...);
+            }
+    };
+}
+
+/**
+ * A window over the last W tuples of a stream, aggregated elementwise. For instance,
+ * a rolling count, sum, min and max can be kept by pushing tuples such as `(1, x, x, x)`
+ * with combiners adding, adding, taking the min and taking the max of elements.
+ * @tparam W The number of tuples in the window.
+ * @tparam T The aggregated tuple type.
+ * @tparam F The elementwise combiners types.
+ * @since 1.0
+ */
+template <size_t W, typename T, typename ...F>
+class sliding_window_t
+{
+    static_assert(W > 0, "windows must hold at least one tuple");
+
+    private:
+        detail::two_stack_t<T, F...> m_stacks;
+
+    public:
+        /**
+         * Creates a new empty window.
+         * @param identity The identity tuple of all combiners.
+         * @param combiners The elementwise combiners.
+         */
+        inline sliding_window_t(const T& identity, const F&... combiners)
+          : m_stacks (identity, combiners...)
+        {
+            m_stacks.reserve(W);
+        }
+
+        /**
+         * Pushes a tuple into the window, evicting the oldest one if it is full.
+         * @param value The tuple to be pushed.
+         */
+        inline void push(const T& value)
+        {
+            if (m_stacks.size() == W) m_stacks.pop();
+            m_stacks.push(value);
+        }
+
+        /**
+         * Aggregates all tuples in the window.
+         * @return The window's aggregate.
+         */
+        inline T query() const
+        {
+            return m_stacks.query();
+        }
+
+        /**
+         * Informs the number of tuples in the window.
+         * @return The window's size.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_stacks.size();
+        }
+
+        /**
+         * Removes all tuples from the window.
+         */
+        inline void clear() noexcept
+        {
+            m_stacks.clear();
+        }
+};
+
+/**
+ * A window over the tuples of a stream within a time span, aggregated elementwise.
+ * Tuples must be pushed in nondecreasing time order, and a tuple is evicted once the
+ * newest time is at least a span after its own.
+ * @tparam K The time type, either a number or a duration since some epoch.
+ * @tparam T The aggregated tuple type.
+ * @tparam F The elementwise combiners types.
+ * @since 1.0
+ */
+template <typename K, typename T, typename ...F>
+class time_window_t
+{
+    private:
+        K m_span;
+        std::deque<K> m_times;
+        detail::two_stack_t<T, F...> m_stacks;
+
+    public:
+        /**
+         * Creates a new empty window.
+         * @param span The time span covered by the window.
+         * @param identity The identity tuple of all combiners.
+         * @param combiners The elementwise combiners.
+         */
+        inline time_window_t(const K& span, const T& identity, const F&... combiners)
+          : m_span (span)
+          , m_stacks (identity, combiners...)
+        {}
+
+        /**
+         * Pushes a tuple into the window, evicting the tuples that became too old.
+         * @param time The tuple's time.
+         * @param value The tuple to be pushed.
+         */
+        inline void push(const K& time, const T& value)
+        {
+            advance(time);
+            m_times.push_back(time);
+            m_stacks.push(value);
+        }
+
+        /**
+         * Evicts the tuples that are too old at the given time.
+         * @param now The current time.
+         */
+        inline void advance(const K& now)
+        {
+            while (!m_times.empty() && !(now - m_times.front() < m_span)) {
+                m_times.pop_front();
+                m_stacks.pop();
+            }
+        }
+
+        /**
+         * Aggregates all tuples in the window.
+         * @return The window's aggregate.
+         */
+        inline T query() const
+        {
+            return m_stacks.query();
+        }
+
+        /**
+         * Informs the number of tuples in the window.
+         * @return The window's size.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_stacks.size();
+        }
+
+        /**
+         * Removes all tuples from the window.
+         */
+        inline void clear() noexcept
+        {
+            m_times.clear();
+            m_stacks.clear();
+        }
+};
+
+/**
+ * Creates a window over the last W tuples of a stream.
+ * @tparam W The number of tuples in the window.
+ * @tparam T The aggregated tuple type.
+ * @tparam F The elementwise combiners types.
+ * @param identity The identity tuple of all combiners.
+ * @param combiners The elementwise combiners.
+ * @return The new empty window.
+ */
+template <size_t W, typename T, typename ...F>
+inline auto sliding_window(const T& identity, const F&... combiners)
+-> sliding_window_t<W, typename T::base_tuple_t, F...>
+{
+    return sliding_window_t<W, typename T::base_tuple_t, F...>(identity, combiners...);
+}
+
+/**
+ * Creates a window over the tuples of a stream within a time span.
+ * @tparam K The time type.
+ * @tparam T The aggregated tuple type.
+ * @tparam F The elementwise combiners types.
+ * @param span The time span covered by the window.
+ * @param identity The identity tuple of all combiners.
+ * @param combiners The elementwise combiners.
+ * @return The new empty window.
+ */
+template <typename K, typename T, typename ...F>
+inline auto sliding_window(const K& span, const T& identity, const F&... combiners)
+-> time_window_t<K, typename T::base_tuple_t, F...>
+{
+    return time_window_t<K, typename T::base_tuple_t, F...>(span, identity, combiners...);
+}
+
+SUPERTUPLE_END_NAMESPACE
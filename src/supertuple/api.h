@@ -22,11 +22,14 @@
 #include <supertuple/operation/last.hpp>
 #include <supertuple/operation/init.hpp>
 #include <supertuple/operation/tail.hpp>
+#include <supertuple/operation/split.hpp>
+#include <supertuple/operation/chunk.hpp>
 
 #include <supertuple/operation/append.hpp>
 #include <supertuple/operation/prepend.hpp>
 #include <supertuple/operation/concat.hpp>
 #include <supertuple/operation/reverse.hpp>
+#include <supertuple/operation/flatten.hpp>
 
 #include <supertuple/operation/fold.hpp>
 #include <supertuple/operation/scan.hpp>
@@ -37,7 +40,13 @@
 
 #include <supertuple/operation/zip.hpp>
 #include <supertuple/operation/zipwith.hpp>
+#include <supertuple/operation/unzip.hpp>
 
+#include <supertuple/operation/find.hpp>
+#include <supertuple/operation/minmax.hpp>
+
+#include <supertuple/operation/hash.hpp>
 #include <supertuple/operation/convert.hpp>
+#include <supertuple/operation/interop.hpp>
 
 #endif
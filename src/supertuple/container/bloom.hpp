@@ -0,0 +1,451 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The bloom filters over tuple keys implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/hash.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Maps a hash value into the range `[0, n)` without a division, by taking
+     * the high half of the product between the hash and the range's size.
+     * @param hash The hash value to be mapped.
+     * @param n The size of the range to map the hash into.
+     * @return The mapped value.
+     */
+    inline uint64_t fastrange(uint64_t hash, uint64_t n) noexcept
+    {
+      #if defined(__SIZEOF_INT128__)
+        return (uint64_t) (((unsigned __int128) hash * n) >> 64);
+      #else
+        return hash % n;
+      #endif
+    }
+
+    /**
+     * Computes the optimal number of bits and of hash functions for a bloom filter
+     * expected to hold the given number of keys with a given false positive rate.
+     * @param expected The number of keys expected to be inserted into the filter.
+     * @param fpr The target false positive rate.
+     * @return The filter's number of bits and of hash functions.
+     */
+    inline std::pair<uint64_t, unsigned> bloom_parameters(size_t expected, double fpr) noexcept
+    {
+        constexpr double ln2 = 0.69314718055994530942;
+
+        const double n = (double) std::max<size_t>(expected, 1);
+        const double p = std::clamp(fpr, 1e-12, .5);
+        const double m = std::ceil(-n * std::log(p) / (ln2 * ln2));
+        const double k = std::round(m / n * ln2);
+
+        return { std::max<uint64_t>((uint64_t) m, 64), (unsigned) std::clamp(k, 1., 16.) };
+    }
+
+    /**
+     * Hashes a probing key for a bloom filter. Any tuple with elements of hash-compatible
+     * types might be used, such as tuples of references created by `tie`.
+     * @tparam K The filter's key tuple type.
+     * @tparam U The probing key type.
+     * @param key The key to be hashed.
+     * @return The key's hash value.
+     */
+    template <typename K, typename U>
+    inline uint64_t bloom_hash(const U& key)
+    {
+        static_assert(U::count == K::count, "bloom filter keys must have the same number of elements");
+        return operation::hash(key);
+    }
+}
+
+/**
+ * A bloom filter over tuple keys. The filter answers whether a key might have been
+ * inserted, without false negatives, and thus is a cheap negative check before
+ * probing a much bigger tuple-keyed structure. Each key's probing positions are
+ * derived from the tuple hash with double hashing.
+ * @tparam T The filter's key tuple type.
+ * @since 1.0
+ */
+template <typename T>
+class bloom_filter;
+
+/**
+ * A blocked bloom filter over tuple keys. Instead of spreading a key's bits over
+ * the whole filter, they are all set within a single cache-line sized block, so
+ * that a probe touches a single cache line and can be tested at once.
+ * @tparam T The filter's key tuple type.
+ * @since 1.0
+ */
+template <typename T>
+class blocked_bloom_filter;
+
+/**
+ * The bloom filter over keys of the given tuple type.
+ * @tparam K The key tuple's element types.
+ * @since 1.0
+ */
+template <typename ...K>
+class bloom_filter<tuple_t<K...>>
+{
+    public:
+        typedef tuple_t<K...> key_t;
+
+    private:
+        std::vector<uint64_t> m_words;
+        uint64_t m_bits = 0;
+        unsigned m_hashes = 0;
+
+    public:
+        inline bloom_filter() noexcept = delete;
+        inline bloom_filter(const bloom_filter&) = default;
+        inline bloom_filter(bloom_filter&&) noexcept = default;
+
+        /**
+         * Creates a new empty filter sized for the given workload.
+         * @param expected The number of keys expected to be inserted.
+         * @param fpr The target false positive rate.
+         */
+        inline explicit bloom_filter(size_t expected, double fpr = .01)
+        {
+            const auto [bits, hashes] = detail::bloom_parameters(expected, fpr);
+            m_bits = (bits + 63) / 64 * 64;
+            m_hashes = hashes;
+            m_words.assign(m_bits / 64, 0);
+        }
+
+        inline bloom_filter& operator=(const bloom_filter&) = default;
+        inline bloom_filter& operator=(bloom_filter&&) noexcept = default;
+
+        /**
+         * Inserts a key into the filter.
+         * @tparam U The inserted key type.
+         * @param key The key to be inserted.
+         */
+        template <typename U>
+        inline void insert(const U& key)
+        {
+            const uint64_t h1 = detail::bloom_hash<key_t>(key);
+            const uint64_t h2 = detail::mix(h1) | 1;
+
+            for (unsigned i = 0; i < m_hashes; ++i) {
+                const uint64_t bit = detail::fastrange(h1 + i * h2, m_bits);
+                m_words[bit / 64] |= uint64_t(1) << (bit % 64);
+            }
+        }
+
+        /**
+         * Checks whether a key might have been inserted into the filter.
+         * @tparam U The probing key type.
+         * @param key The key to be checked.
+         * @return May the key be in the filter?
+         */
+        template <typename U>
+        inline bool contains(const U& key) const
+        {
+            return test(detail::bloom_hash<key_t>(key));
+        }
+
+        /**
+         * Checks a batch of keys against the filter. All keys are hashed and have
+         * their first probed word prefetched before any of them is tested, so that
+         * the memory accesses of different keys overlap.
+         * @tparam I The keys' iterator type.
+         * @tparam O The results' output iterator type.
+         * @param first The iterator to the batch's first key.
+         * @param count The number of keys in the batch.
+         * @param out The output iterator for whether each key may be in the filter.
+         * @return The number of keys that may be in the filter.
+         */
+        template <typename I, typename O>
+        inline size_t contains_n(I first, size_t count, O out) const
+        {
+            constexpr size_t stride = 16;
+            uint64_t hash[stride];
+            size_t positives = 0;
+
+            for (size_t i = 0; i < count; i += stride) {
+                const size_t n = std::min(stride, count - i);
+
+                for (size_t j = 0; j < n; ++j, ++first) {
+                    hash[j] = detail::bloom_hash<key_t>(*first);
+                    detail::simd::prefetch(&m_words[detail::fastrange(hash[j], m_bits) / 64]);
+                }
+
+                for (size_t j = 0; j < n; ++j, ++out) {
+                    const bool positive = test(hash[j]);
+                    *out = positive;
+                    positives += positive;
+                }
+            }
+
+            return positives;
+        }
+
+        /**
+         * Removes all keys from the filter.
+         */
+        inline void clear() noexcept
+        {
+            std::fill(m_words.begin(), m_words.end(), 0);
+        }
+
+        /**
+         * Informs the number of bits in the filter.
+         * @return The filter's number of bits.
+         */
+        inline size_t bits() const noexcept
+        {
+            return (size_t) m_bits;
+        }
+
+        /**
+         * Informs the number of bits probed for each key.
+         * @return The filter's number of hash functions.
+         */
+        inline unsigned hashes() const noexcept
+        {
+            return m_hashes;
+        }
+
+    private:
+        /**
+         * Tests whether all bits probed by a hash value are set.
+         * @param h1 The hash value to be tested.
+         * @return Are all of the probed bits set?
+         */
+        inline bool test(uint64_t h1) const noexcept
+        {
+            const uint64_t h2 = detail::mix(h1) | 1;
+
+            for (unsigned i = 0; i < m_hashes; ++i) {
+                const uint64_t bit = detail::fastrange(h1 + i * h2, m_bits);
+                if (!(m_words[bit / 64] & (uint64_t(1) << (bit % 64)))) return false;
+            }
+
+            return true;
+        }
+};
+
+/**
+ * The blocked bloom filter over keys of the given tuple type.
+ * @tparam K The key tuple's element types.
+ * @since 1.0
+ */
+template <typename ...K>
+class blocked_bloom_filter<tuple_t<K...>>
+{
+    public:
+        typedef tuple_t<K...> key_t;
+
+    private:
+        /**
+         * A filter block, sized and aligned to a cache line.
+         * @since 1.0
+         */
+        struct alignas(64) block_t
+        {
+            uint64_t word[8];
+        };
+
+    private:
+        std::vector<block_t> m_blocks;
+        unsigned m_hashes = 0;
+
+    public:
+        inline blocked_bloom_filter() noexcept = delete;
+        inline blocked_bloom_filter(const blocked_bloom_filter&) = default;
+        inline blocked_bloom_filter(blocked_bloom_filter&&) noexcept = default;
+
+        /**
+         * Creates a new empty filter sized for the given workload.
+         * @param expected The number of keys expected to be inserted.
+         * @param fpr The target false positive rate.
+         */
+        inline explicit blocked_bloom_filter(size_t expected, double fpr = .01)
+        {
+            const auto [bits, hashes] = detail::bloom_parameters(expected, fpr);
+            m_blocks.assign((bits + 511) / 512, block_t {});
+            m_hashes = hashes;
+        }
+
+        inline blocked_bloom_filter& operator=(const blocked_bloom_filter&) = default;
+        inline blocked_bloom_filter& operator=(blocked_bloom_filter&&) noexcept = default;
+
+        /**
+         * Inserts a key into the filter.
+         * @tparam U The inserted key type.
+         * @param key The key to be inserted.
+         */
+        template <typename U>
+        inline void insert(const U& key)
+        {
+            const uint64_t hash = detail::bloom_hash<key_t>(key);
+            const block_t mask = pattern(hash);
+
+            block_t& block = m_blocks[locate(hash)];
+
+            for (size_t i = 0; i < 8; ++i)
+                block.word[i] |= mask.word[i];
+        }
+
+        /**
+         * Checks whether a key might have been inserted into the filter.
+         * @tparam U The probing key type.
+         * @param key The key to be checked.
+         * @return May the key be in the filter?
+         */
+        template <typename U>
+        inline bool contains(const U& key) const
+        {
+            const uint64_t hash = detail::bloom_hash<key_t>(key);
+            return test(m_blocks[locate(hash)], hash);
+        }
+
+        /**
+         * Checks a batch of keys against the filter. All keys are hashed and have
+         * their blocks prefetched before any of them is tested, so that the memory
+         * accesses of different keys overlap.
+         * @tparam I The keys' iterator type.
+         * @tparam O The results' output iterator type.
+         * @param first The iterator to the batch's first key.
+         * @param count The number of keys in the batch.
+         * @param out The output iterator for whether each key may be in the filter.
+         * @return The number of keys that may be in the filter.
+         */
+        template <typename I, typename O>
+        inline size_t contains_n(I first, size_t count, O out) const
+        {
+            constexpr size_t stride = 16;
+            uint64_t hash[stride];
+            const block_t *block[stride];
+            size_t positives = 0;
+
+            for (size_t i = 0; i < count; i += stride) {
+                const size_t n = std::min(stride, count - i);
+
+                for (size_t j = 0; j < n; ++j, ++first) {
+                    hash[j] = detail::bloom_hash<key_t>(*first);
+                    block[j] = &m_blocks[locate(hash[j])];
+                    detail::simd::prefetch(block[j]);
+                }
+
+                for (size_t j = 0; j < n; ++j, ++out) {
+                    const bool positive = test(*block[j], hash[j]);
+                    *out = positive;
+                    positives += positive;
+                }
+            }
+
+            return positives;
+        }
+
+        /**
+         * Removes all keys from the filter.
+         */
+        inline void clear() noexcept
+        {
+            std::fill(m_blocks.begin(), m_blocks.end(), block_t {});
+        }
+
+        /**
+         * Informs the number of bits in the filter.
+         * @return The filter's number of bits.
+         */
+        inline size_t bits() const noexcept
+        {
+            return m_blocks.size() * 512;
+        }
+
+        /**
+         * Informs the number of bits probed for each key.
+         * @return The filter's number of hash functions.
+         */
+        inline unsigned hashes() const noexcept
+        {
+            return m_hashes;
+        }
+
+    private:
+        /**
+         * Selects the block a hash value maps to.
+         * @param hash The hash value to be mapped.
+         * @return The index of the hash's block.
+         */
+        inline size_t locate(uint64_t hash) const noexcept
+        {
+            return (size_t) detail::fastrange(hash, m_blocks.size());
+        }
+
+        /**
+         * Builds the pattern of bits a hash value sets within its block. The bits'
+         * positions are derived with double hashing from a remixed hash value,
+         * taking the top 9 bits of each 32-bit probe.
+         * @param hash The hash value to build a pattern for.
+         * @return The hash's bit pattern.
+         */
+        inline block_t pattern(uint64_t hash) const noexcept
+        {
+            const uint64_t remix = detail::mix(hash);
+            const uint32_t h1 = (uint32_t) remix;
+            const uint32_t h2 = (uint32_t) (remix >> 32) | 1;
+
+            block_t mask {};
+
+            for (unsigned i = 0; i < m_hashes; ++i) {
+                const uint32_t bit = (h1 + i * h2) >> 23;
+                mask.word[bit / 64] |= uint64_t(1) << (bit % 64);
+            }
+
+            return mask;
+        }
+
+        /**
+         * Tests whether all bits in a hash value's pattern are set in a block. The
+         * block is tested with full-width vector operations, without any branches.
+         * @param block The block to be tested.
+         * @param hash The hash value to be tested.
+         * @return Are all of the pattern's bits set in the block?
+         */
+        inline bool test(const block_t& block, uint64_t hash) const noexcept
+        {
+            const block_t mask = pattern(hash);
+
+          #if defined(SUPERTUPLE_SIMD_ENABLED)
+            using vector_t = detail::simd::vector_t<uint64_t>;
+            constexpr size_t lanes = sizeof(vector_t) / sizeof(uint64_t);
+
+            vector_t missing {};
+
+            for (size_t i = 0; i < 8; i += lanes) {
+                const auto b = detail::simd::load<vector_t>(block.word + i);
+                const auto m = detail::simd::load<vector_t>(mask.word + i);
+                missing |= m & ~b;
+            }
+
+            return !detail::simd::any(missing);
+          #else
+            uint64_t missing = 0;
+            for (size_t i = 0; i < 8; ++i)
+                missing |= mask.word[i] & ~block.word[i];
+            return missing == 0;
+          #endif
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
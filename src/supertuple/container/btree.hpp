@@ -0,0 +1,855 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The B+tree map keyed by tuples implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Shifts all indeces in a sequence by a given offset.
+     * @tparam O The offset to be added to the indeces.
+     * @tparam I The sequence's indeces.
+     * @return The shifted index sequence.
+     */
+    template <size_t O, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto offset(std::index_sequence<I...>) noexcept
+    -> std::index_sequence<(O + I)...>;
+
+    /**
+     * Finds the bound of a value within a sorted column. Arithmetic columns are
+     * searched with branchless vector comparisons, while others are bisected.
+     * @tparam E Whether the bound must be placed after equivalent elements.
+     * @tparam T The column's elements' type.
+     * @tparam U The searched value's type.
+     * @param data The column's first element.
+     * @param n The number of elements in the column.
+     * @param value The value to be searched.
+     * @return The position of the value's lower or upper bound.
+     */
+    template <bool E, typename T, typename U>
+    inline size_t bound(const T *data, size_t n, const U& value) noexcept
+    {
+        if constexpr (std::is_arithmetic_v<T>) {
+            return simd::rank<E>(data, n, value);
+        } else if constexpr (E) {
+            return (size_t) (std::upper_bound(data, data + n, value) - data);
+        } else {
+            return (size_t) (std::lower_bound(data, data + n, value) - data);
+        }
+    }
+}
+
+/**
+ * An ordered map keyed by tuples, implemented as a B+tree with wide nodes. Each
+ * node stores its keys in structure-of-arrays form, one column per key element,
+ * so that searching a node scans the contiguous leading column with vector compares
+ * and only looks at the remaining columns within the run of equivalent leading
+ * elements. All values live in leaves, which are linked for fast in-order scans.
+ * @tparam T The map's key tuple type.
+ * @tparam V The map's mapped value type.
+ * @tparam B The maximum number of keys in a node.
+ * @since 1.0
+ */
+template <typename T, typename V, size_t B = 64>
+class btree_map;
+
+/**
+ * The B+tree map over keys of the given tuple type. Erasing keys never merges nodes,
+ * so leaves may become sparse or empty after erasures, which is the common trade-off
+ * for ever-growing indexes.
+ * @tparam K The key tuple's element types.
+ * @tparam V The map's mapped value type.
+ * @tparam B The maximum number of keys in a node.
+ * @since 1.0
+ */
+template <typename ...K, typename V, size_t B>
+class btree_map<tuple_t<K...>, V, B>
+{
+    static_assert(B >= 4 && B % 2 == 0, "nodes must hold an even number of at least 4 keys");
+
+    public:
+        typedef tuple_t<K...> key_t;
+        typedef V mapped_t;
+        typedef tuple_t<const K&...> key_reference_t;
+
+        static constexpr size_t arity = sizeof...(K);
+        static constexpr size_t capacity = B;
+
+    private:
+        typedef std::make_index_sequence<arity> indexer_t;
+        typedef tuple_t<std::array<K, B>...> columns_t;
+
+        /**
+         * The common header of tree nodes, which holds the node's keys in columns.
+         * @since 1.0
+         */
+        struct node_t
+        {
+            columns_t keys;
+            uint32_t count = 0;
+            bool leaf;
+
+            inline explicit node_t(bool leaf) noexcept : leaf (leaf) {}
+        };
+
+        /**
+         * An inner node, which holds the separator keys between its children.
+         * @since 1.0
+         */
+        struct inner_t : public node_t
+        {
+            node_t *child[B + 1];
+
+            inline inner_t() noexcept : node_t (false) {}
+        };
+
+        /**
+         * A leaf node, which holds the keys' mapped values.
+         * @since 1.0
+         */
+        struct leaf_t : public node_t
+        {
+            std::array<V, B> values;
+            leaf_t *prev = nullptr;
+            leaf_t *next = nullptr;
+
+            inline leaf_t() noexcept : node_t (true) {}
+        };
+
+    public:
+        /**
+         * The map's iterator, which walks the linked leaves in key order.
+         * @tparam C Is the iterator const-qualified?
+         * @since 1.0
+         */
+        template <bool C>
+        class iterator_t
+        {
+            public:
+                typedef std::conditional_t<C, const V, V> value_t;
+                typedef pair_t<key_reference_t, value_t&> reference_t;
+
+            private:
+                leaf_t *m_leaf = nullptr;
+                size_t m_pos = 0;
+
+            public:
+                inline iterator_t() noexcept = default;
+                inline iterator_t(const iterator_t&) noexcept = default;
+
+                /**
+                 * Creates an iterator at the given leaf position, normalizing it to
+                 * the next existing element if the position is past the leaf's end.
+                 * @param leaf The leaf to point to.
+                 * @param pos The element's position within the leaf.
+                 */
+                inline iterator_t(leaf_t *leaf, size_t pos) noexcept
+                  : m_leaf (leaf)
+                  , m_pos (pos)
+                {
+                    normalize();
+                }
+
+                /**
+                 * Converts a mutable iterator into a const-qualified one.
+                 * @param other The iterator to be converted.
+                 */
+                template <bool D, typename = std::enable_if_t<C && !D>>
+                inline iterator_t(const iterator_t<D>& other) noexcept
+                  : m_leaf (other.m_leaf)
+                  , m_pos (other.m_pos)
+                {}
+
+                inline iterator_t& operator=(const iterator_t&) noexcept = default;
+
+                /**
+                 * Retrieves the key pointed to by the iterator.
+                 * @return The tuple of references to the key's elements.
+                 */
+                inline key_reference_t key() const noexcept
+                {
+                    return btree_map::key_at(m_leaf->keys, m_pos, indexer_t());
+                }
+
+                /**
+                 * Retrieves the value pointed to by the iterator.
+                 * @return The mapped value's reference.
+                 */
+                inline value_t& value() const noexcept
+                {
+                    return m_leaf->values[m_pos];
+                }
+
+                /**
+                 * Retrieves the key-value pair pointed to by the iterator.
+                 * @return The pair of the key and value's references.
+                 */
+                inline reference_t operator*() const noexcept
+                {
+                    return reference_t(key(), value());
+                }
+
+                /**
+                 * Advances the iterator to the next element in key order.
+                 * @return The advanced iterator.
+                 */
+                inline iterator_t& operator++() noexcept
+                {
+                    ++m_pos;
+                    return detail::swallow(*this, normalize());
+                }
+
+                /**
+                 * Advances the iterator to the next element in key order.
+                 * @return The iterator before being advanced.
+                 */
+                inline iterator_t operator++(int) noexcept
+                {
+                    iterator_t previous = *this;
+                    return detail::swallow(previous, operator++());
+                }
+
+                /**
+                 * Checks whether two iterators point to the same element.
+                 * @param other The iterator to compare with.
+                 * @return Are both iterators equal?
+                 */
+                inline bool operator==(const iterator_t& other) const noexcept
+                {
+                    return m_leaf == other.m_leaf && m_pos == other.m_pos;
+                }
+
+                /**
+                 * Checks whether two iterators point to different elements.
+                 * @param other The iterator to compare with.
+                 * @return Are the iterators different?
+                 */
+                inline bool operator!=(const iterator_t& other) const noexcept
+                {
+                    return !operator==(other);
+                }
+
+            private:
+                /**
+                 * Moves the iterator forward while it points past its leaf's end.
+                 * @return The normalized iterator.
+                 */
+                inline iterator_t& normalize() noexcept
+                {
+                    while (m_leaf != nullptr && m_pos >= m_leaf->count) {
+                        m_leaf = m_leaf->next;
+                        m_pos = 0;
+                    }
+
+                    return *this;
+                }
+
+            friend class btree_map;
+            template <bool> friend class iterator_t;
+        };
+
+        typedef iterator_t<false> iterator;
+        typedef iterator_t<true> const_iterator;
+
+        /**
+         * A range of elements, delimited by two iterators.
+         * @tparam C Is the range const-qualified?
+         * @since 1.0
+         */
+        template <bool C>
+        struct range_t
+        {
+            iterator_t<C> first, last;
+
+            inline iterator_t<C> begin() const noexcept { return first; }
+            inline iterator_t<C> end() const noexcept { return last; }
+            inline bool empty() const noexcept { return first == last; }
+        };
+
+    private:
+        node_t *m_root = nullptr;
+        leaf_t *m_first = nullptr;
+        size_t m_size = 0;
+
+    public:
+        inline btree_map() noexcept = default;
+        inline btree_map(const btree_map&) = delete;
+
+        /**
+         * Acquires the contents of another map.
+         * @param other The map to be moved.
+         */
+        inline btree_map(btree_map&& other) noexcept
+          : m_root (std::exchange(other.m_root, nullptr))
+          , m_first (std::exchange(other.m_first, nullptr))
+          , m_size (std::exchange(other.m_size, 0))
+        {}
+
+        /**
+         * Releases all of the map's nodes.
+         */
+        inline ~btree_map()
+        {
+            release(m_root);
+        }
+
+        inline btree_map& operator=(const btree_map&) = delete;
+
+        /**
+         * Acquires the contents of another map, releasing the current ones.
+         * @param other The map to be moved.
+         * @return The current map instance.
+         */
+        inline btree_map& operator=(btree_map&& other) noexcept
+        {
+            std::swap(m_root, other.m_root);
+            std::swap(m_first, other.m_first);
+            std::swap(m_size, other.m_size);
+            return *this;
+        }
+
+        /**
+         * Inserts a key into the map if it is not yet present.
+         * @tparam U The inserted key type.
+         * @tparam W The inserted value type.
+         * @param key The key to be inserted.
+         * @param value The value to be mapped to the key.
+         * @return The key's position and whether it has been inserted.
+         */
+        template <typename U, typename W>
+        inline std::pair<iterator, bool> insert(const U& key, W&& value)
+        {
+            static_assert(U::count == arity, "inserted keys must have all key elements");
+
+            inner_t *path[64];
+            size_t slot[64];
+            size_t depth = 0;
+
+            if (m_root == nullptr)
+                m_root = m_first = new leaf_t;
+
+            node_t *node = m_root;
+
+            for (; !node->leaf; ++depth) {
+                path[depth] = static_cast<inner_t*>(node);
+                slot[depth] = search<arity, true>(node, key);
+                node = path[depth]->child[slot[depth]];
+            }
+
+            auto leaf = static_cast<leaf_t*>(node);
+            size_t pos = search<arity, false>(leaf, key);
+
+            if (pos < leaf->count && compare(leaf->keys, pos, key, indexer_t()) == 0)
+                return { iterator(leaf, pos), false };
+
+            if (leaf->count == B) {
+                leaf_t *right = split(leaf);
+                key_t separator = key_at(right->keys, 0, indexer_t());
+
+                if (pos > B / 2) {
+                    pos -= B / 2;
+                    leaf = right;
+                }
+
+                propagate(path, slot, depth, std::move(separator), right);
+            }
+
+            shift(leaf->keys, pos, leaf->count, indexer_t());
+            std::move_backward(&leaf->values[pos], &leaf->values[leaf->count], &leaf->values[leaf->count + 1]);
+
+            assign(leaf->keys, pos, key, indexer_t());
+            leaf->values[pos] = std::forward<decltype(value)>(value);
+
+            ++leaf->count;
+            ++m_size;
+
+            return { iterator(leaf, pos), true };
+        }
+
+        /**
+         * Inserts a key into the map or replaces its mapped value. The value is moved
+         * into the map whenever possible, so move-only values are also supported.
+         * @tparam U The inserted key type.
+         * @tparam W The inserted value type.
+         * @param key The key to be inserted or updated.
+         * @param value The value to be mapped to the key.
+         * @return The key's position.
+         */
+        template <typename U, typename W>
+        inline iterator insert_or_assign(const U& key, W&& value)
+        {
+            iterator it = find(key);
+
+            if (it == end())
+                return insert(key, std::forward<W>(value)).first;
+
+            it.value() = std::forward<W>(value);
+            return it;
+        }
+
+        /**
+         * Retrieves the value mapped to a key, inserting a default one if needed.
+         * @tparam U The key type.
+         * @param key The key to be retrieved.
+         * @return The key's mapped value.
+         */
+        template <typename U>
+        inline V& operator[](const U& key)
+        {
+            return insert(key, V()).first.value();
+        }
+
+        /**
+         * Removes a key from the map.
+         * @tparam U The key type.
+         * @param key The key to be removed.
+         * @return Has the key been found and removed?
+         */
+        template <typename U>
+        inline bool erase(const U& key)
+        {
+            iterator it = find(key);
+            if (it == end()) return false;
+
+            leaf_t *leaf = it.m_leaf;
+            const size_t pos = it.m_pos;
+
+            unshift(leaf->keys, pos, leaf->count, indexer_t());
+            std::move(&leaf->values[pos + 1], &leaf->values[leaf->count], &leaf->values[pos]);
+
+            --leaf->count;
+            --m_size;
+
+            return true;
+        }
+
+        /**
+         * Searches for a key in the map. The key may be any tuple with elements comparable
+         * to the map's key elements, such as a tuple of references created by `tie`.
+         * @tparam U The searched key type.
+         * @param key The key to be searched.
+         * @return The key's position, or the end iterator if not found.
+         */
+        template <typename U>
+        inline iterator find(const U& key) noexcept
+        {
+            static_assert(U::count == arity, "searched keys must have all key elements");
+            iterator it = lower_bound(key);
+            return (it != end() && compare(it.m_leaf->keys, it.m_pos, key, indexer_t()) == 0) ? it : end();
+        }
+
+        /**
+         * Searches for a key in the const-qualified map.
+         * @tparam U The searched key type.
+         * @param key The key to be searched.
+         * @return The key's position, or the end iterator if not found.
+         */
+        template <typename U>
+        inline const_iterator find(const U& key) const noexcept
+        {
+            return const_cast<btree_map*>(this)->find(key);
+        }
+
+        /**
+         * Finds the first element whose key is not lesser than the given one. The
+         * key may have fewer elements than the map's keys, in which case only the
+         * map's leading key elements are compared to it.
+         * @tparam U The searched key type.
+         * @param key The key to be searched.
+         * @return The position of the key's lower bound.
+         */
+        template <typename U>
+        inline iterator lower_bound(const U& key) noexcept
+        {
+            return locate<U::count, false>(key);
+        }
+
+        /**
+         * Finds the first element whose key is greater than the given one. The key
+         * may have fewer elements than the map's keys, in which case only the map's
+         * leading key elements are compared to it.
+         * @tparam U The searched key type.
+         * @param key The key to be searched.
+         * @return The position of the key's upper bound.
+         */
+        template <typename U>
+        inline iterator upper_bound(const U& key) noexcept
+        {
+            return locate<U::count, true>(key);
+        }
+
+        /**
+         * Retrieves all elements whose keys' leading elements are equal to a prefix.
+         * For instance, all keys with a given tenant can be retrieved from a map keyed
+         * by tenant, timestamp and sequence numbers with a single-element prefix.
+         * @tparam U The prefix type.
+         * @param prefix The prefix of the keys to be retrieved.
+         * @return The range of elements with the given prefix.
+         */
+        template <typename U>
+        inline range_t<false> equal_prefix(const U& prefix) noexcept
+        {
+            return { lower_bound(prefix), upper_bound(prefix) };
+        }
+
+        /**
+         * Retrieves all elements of the const-qualified map with the given prefix.
+         * @tparam U The prefix type.
+         * @param prefix The prefix of the keys to be retrieved.
+         * @return The range of elements with the given prefix.
+         */
+        template <typename U>
+        inline range_t<true> equal_prefix(const U& prefix) const noexcept
+        {
+            auto range = const_cast<btree_map*>(this)->equal_prefix(prefix);
+            return { range.first, range.last };
+        }
+
+        /**
+         * Scans a range of elements, one leaf at a time. Each leaf's elements are
+         * visited by a tight loop over its columns, without going through iterators.
+         * @tparam F The visitor functor type.
+         * @param first The range's first element.
+         * @param last The range's end.
+         * @param lambda The visitor to be invoked with each key and value.
+         */
+        template <typename F>
+        inline void scan(const_iterator first, const_iterator last, F&& lambda) const
+        {
+            for (leaf_t *leaf = first.m_leaf; leaf != nullptr; leaf = leaf->next) {
+                const size_t start = leaf == first.m_leaf ? first.m_pos : 0;
+                const size_t stop = leaf == last.m_leaf ? last.m_pos : leaf->count;
+
+                for (size_t i = start; i < stop; ++i)
+                    detail::invoke(lambda, key_at(leaf->keys, i, indexer_t()), std::as_const(leaf->values[i]));
+
+                if (leaf == last.m_leaf) break;
+            }
+        }
+
+        /**
+         * Scans all elements in the map, one leaf at a time.
+         * @tparam F The visitor functor type.
+         * @param lambda The visitor to be invoked with each key and value.
+         */
+        template <typename F>
+        inline void scan(F&& lambda) const
+        {
+            scan(begin(), end(), lambda);
+        }
+
+        /**
+         * Removes all elements from the map.
+         */
+        inline void clear() noexcept
+        {
+            release(m_root);
+            m_root = m_first = nullptr;
+            m_size = 0;
+        }
+
+        inline iterator begin() noexcept { return iterator(m_first, 0); }
+        inline iterator end() noexcept { return iterator(); }
+        inline const_iterator begin() const noexcept { return const_iterator(m_first, 0); }
+        inline const_iterator end() const noexcept { return const_iterator(); }
+
+        /**
+         * Informs the number of elements in the map.
+         * @return The map's number of elements.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * Informs whether the map is empty.
+         * @return Is the map empty?
+         */
+        inline bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+    private:
+        /**
+         * Descends the tree to the bound of a possibly partial key.
+         * @tparam P The number of leading key elements to be compared.
+         * @tparam E Whether the upper bound must be found.
+         * @tparam U The searched key type.
+         * @param key The key to be searched.
+         * @return The position of the key's bound.
+         */
+        template <size_t P, bool E, typename U>
+        inline iterator locate(const U& key) const noexcept
+        {
+            static_assert(P > 0 && P <= arity, "searched keys must have at most all key elements");
+
+            if (m_root == nullptr)
+                return iterator();
+
+            node_t *node = m_root;
+
+            while (!node->leaf)
+                node = static_cast<inner_t*>(node)->child[search<P, E>(node, key)];
+
+            return iterator(static_cast<leaf_t*>(node), search<P, E>(node, key));
+        }
+
+        /**
+         * Searches for the bound of a possibly partial key within a node. The leading
+         * column is searched first, delimiting the run of keys with the same leading
+         * element. Only then, the remaining columns are bisected within the run.
+         * @tparam P The number of leading key elements to be compared.
+         * @tparam E Whether the upper bound must be found.
+         * @tparam U The searched key type.
+         * @param node The node to be searched.
+         * @param key The key to be searched.
+         * @return The number of the node's keys ordered before the bound.
+         */
+        template <size_t P, bool E, typename U>
+        inline static size_t search(const node_t *node, const U& key) noexcept
+        {
+            const auto& column = operation::get<0>(node->keys);
+            const auto& pivot = operation::get<0>(key);
+
+            if constexpr (P == 1) {
+                return detail::bound<E>(column.data(), node->count, pivot);
+            } else {
+                size_t lo = detail::bound<false>(column.data(), node->count, pivot);
+                size_t hi = lo + detail::bound<true>(column.data() + lo, node->count - lo, pivot);
+
+                constexpr auto tail = decltype(detail::offset<1>(std::make_index_sequence<P - 1>()))();
+
+                while (lo < hi) {
+                    const size_t mid = lo + (hi - lo) / 2;
+                    const int result = compare(node->keys, mid, key, tail);
+                    if (E ? result <= 0 : result < 0) lo = mid + 1;
+                    else hi = mid;
+                }
+
+                return lo;
+            }
+        }
+
+        /**
+         * Compares a node's key with a given key, considering only the given elements.
+         * @tparam I The indeces of the key elements to be compared.
+         * @tparam U The given key type.
+         * @param keys The node's key columns.
+         * @param pos The position of the node's key to be compared.
+         * @param key The given key to compare with.
+         * @return The relative order of the node's key to the given one.
+         */
+        template <typename U, size_t ...I>
+        inline static int compare(const columns_t& keys, size_t pos, const U& key, std::index_sequence<I...>) noexcept
+        {
+            int result = 0;
+            ((result = detail::compare(operation::get<I>(keys)[pos], operation::get<I>(key))) || ...);
+            return result;
+        }
+
+        /**
+         * Gathers references to a node's key elements at a given position.
+         * @tparam I The key tuple's sequence indeces.
+         * @param keys The node's key columns.
+         * @param pos The position of the key to be gathered.
+         * @return The tuple of references to the key's elements.
+         */
+        template <size_t ...I>
+        inline static key_reference_t key_at(const columns_t& keys, size_t pos, std::index_sequence<I...>) noexcept
+        {
+            return key_reference_t(operation::get<I>(keys)[pos]...);
+        }
+
+        /**
+         * Scatters a key's elements into a node's columns at a given position.
+         * @tparam U The key type.
+         * @tparam I The key tuple's sequence indeces.
+         * @param keys The node's key columns.
+         * @param pos The position the key must be written to.
+         * @param key The key to be written.
+         */
+        template <typename U, size_t ...I>
+        inline static void assign(columns_t& keys, size_t pos, const U& key, std::index_sequence<I...>)
+        {
+            ((operation::get<I>(keys)[pos] = operation::get<I>(key)), ...);
+        }
+
+        /**
+         * Opens a gap in a node's columns by shifting keys one position to the right.
+         * @tparam I The key tuple's sequence indeces.
+         * @param keys The node's key columns.
+         * @param pos The position of the gap to be opened.
+         * @param count The number of keys in the node.
+         */
+        template <size_t ...I>
+        inline static void shift(columns_t& keys, size_t pos, size_t count, std::index_sequence<I...>)
+        {
+            ((std::move_backward(
+                &operation::get<I>(keys)[pos]
+              , &operation::get<I>(keys)[count]
+              , &operation::get<I>(keys)[count + 1])), ...);
+        }
+
+        /**
+         * Closes a gap in a node's columns by shifting keys one position to the left.
+         * @tparam I The key tuple's sequence indeces.
+         * @param keys The node's key columns.
+         * @param pos The position of the gap to be closed.
+         * @param count The number of keys in the node.
+         */
+        template <size_t ...I>
+        inline static void unshift(columns_t& keys, size_t pos, size_t count, std::index_sequence<I...>)
+        {
+            ((std::move(
+                &operation::get<I>(keys)[pos + 1]
+              , &operation::get<I>(keys)[count]
+              , &operation::get<I>(keys)[pos])), ...);
+        }
+
+        /**
+         * Moves a run of keys from a node's columns to another's.
+         * @tparam I The key tuple's sequence indeces.
+         * @param dst The destination node's key columns.
+         * @param src The source node's key columns.
+         * @param from The position of the first key to be moved.
+         * @param count The number of keys to be moved.
+         */
+        template <size_t ...I>
+        inline static void transfer(columns_t& dst, columns_t& src, size_t from, size_t count, std::index_sequence<I...>)
+        {
+            ((std::move(
+                &operation::get<I>(src)[from]
+              , &operation::get<I>(src)[from + count]
+              , &operation::get<I>(dst)[0])), ...);
+        }
+
+        /**
+         * Splits a full leaf in half, moving its upper half to a new right sibling.
+         * @param leaf The leaf to be split.
+         * @return The new right sibling leaf.
+         */
+        inline leaf_t *split(leaf_t *leaf)
+        {
+            constexpr size_t half = B / 2;
+            auto right = new leaf_t;
+
+            transfer(right->keys, leaf->keys, half, half, indexer_t());
+            std::move(&leaf->values[half], &leaf->values[B], &right->values[0]);
+
+            right->count = half;
+            leaf->count = half;
+
+            right->next = leaf->next;
+            right->prev = leaf;
+            if (leaf->next != nullptr) leaf->next->prev = right;
+            leaf->next = right;
+
+            return right;
+        }
+
+        /**
+         * Inserts a separator and its right child into the inner nodes along the
+         * descent path, splitting full nodes and growing a new root if needed.
+         * @param path The inner nodes along the descent path.
+         * @param slot The child followed at each of the path's nodes.
+         * @param depth The number of nodes in the path.
+         * @param separator The separator key to be inserted.
+         * @param right The node to the right of the separator.
+         */
+        inline void propagate(inner_t **path, size_t *slot, size_t depth, key_t separator, node_t *right)
+        {
+            constexpr size_t half = B / 2;
+
+            while (depth-- > 0) {
+                inner_t *node = path[depth];
+                size_t pos = slot[depth];
+
+                if (node->count == B) {
+                    auto sibling = new inner_t;
+                    key_t middle = key_at(node->keys, half, indexer_t());
+
+                    transfer(sibling->keys, node->keys, half + 1, B - half - 1, indexer_t());
+                    std::copy(&node->child[half + 1], &node->child[B + 1], &sibling->child[0]);
+
+                    sibling->count = B - half - 1;
+                    node->count = half;
+
+                    if (pos > half) {
+                        pos -= half + 1;
+                        node = sibling;
+                    }
+
+                    insert(node, pos, separator, right);
+
+                    separator = std::move(middle);
+                    right = sibling;
+                } else {
+                    return insert(node, pos, separator, right);
+                }
+            }
+
+            auto root = new inner_t;
+            assign(root->keys, 0, separator, indexer_t());
+            root->child[0] = m_root;
+            root->child[1] = right;
+            root->count = 1;
+            m_root = root;
+        }
+
+        /**
+         * Inserts a separator and its right child into an inner node with room.
+         * @param node The inner node to insert into.
+         * @param pos The position the separator must be inserted at.
+         * @param separator The separator key to be inserted.
+         * @param right The node to the right of the separator.
+         */
+        inline static void insert(inner_t *node, size_t pos, const key_t& separator, node_t *right)
+        {
+            shift(node->keys, pos, node->count, indexer_t());
+            std::copy_backward(&node->child[pos + 1], &node->child[node->count + 1], &node->child[node->count + 2]);
+
+            assign(node->keys, pos, separator, indexer_t());
+            node->child[pos + 1] = right;
+            ++node->count;
+        }
+
+        /**
+         * Releases a subtree's nodes.
+         * @param node The subtree's root node.
+         */
+        inline static void release(node_t *node) noexcept
+        {
+            if (node == nullptr) return;
+
+            if (node->leaf) {
+                delete static_cast<leaf_t*>(node);
+            } else {
+                auto inner = static_cast<inner_t*>(node);
+                for (size_t i = 0; i <= inner->count; ++i) release(inner->child[i]);
+                delete inner;
+            }
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
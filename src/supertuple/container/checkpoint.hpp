@@ -0,0 +1,550 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The dirty-block tracking and incremental checkpoints of columnar tables.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/container/soa.hpp>
+#include <supertuple/io/source.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The header of a checkpoint, followed by the size of each column's elements and
+     * then by the given number of blocks, each one preceded by its own header. As a
+     * checkpoint knows where it ends, many of them may be stored in a single file.
+     * @since 1.0
+     */
+    struct checkpoint_header_t
+    {
+        static constexpr uint32_t signature = 0x4b435453;
+
+        uint32_t magic = signature;
+        uint32_t columns = 0;
+        uint64_t rows = 0;
+        uint64_t block = 0;
+        uint64_t blocks = 0;
+    };
+
+    /**
+     * Informs the current offset of an open file.
+     * @param fd The file descriptor to get the offset of.
+     * @return The file's current offset.
+     */
+    inline size_t tell(int fd)
+    {
+        const off_t offset = ::lseek(fd, 0, SEEK_CUR);
+
+        if (offset < 0)
+            throw std::system_error(errno, std::generic_category(), "cannot seek checkpoint file");
+
+        return (size_t) offset;
+    }
+
+    /**
+     * Moves the offset of an open file.
+     * @param fd The file descriptor to move the offset of.
+     * @param offset The file's new offset.
+     */
+    inline void seek(int fd, size_t offset)
+    {
+        if (::lseek(fd, (off_t) offset, SEEK_SET) < 0)
+            throw std::system_error(errno, std::generic_category(), "cannot seek checkpoint file");
+    }
+
+    /**
+     * The header of a block of a column within a checkpoint file. The block's raw
+     * elements follow the header, and their count is implied by the table's size.
+     * @since 1.0
+     */
+    struct checkpoint_block_t
+    {
+        uint64_t column = 0;
+        uint64_t index = 0;
+    };
+
+    /**
+     * Counts the bits set in a word.
+     * @param word The word to count the bits of.
+     * @return The number of bits set.
+     */
+    inline size_t popcount(uint64_t word) noexcept
+    {
+      #if (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_GCC) || (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_CLANG)
+        return (size_t) __builtin_popcountll(word);
+      #else
+        size_t total = 0;
+        for (; word != 0; word &= word - 1) ++total;
+        return total;
+      #endif
+    }
+
+    /**
+     * Finds the lowest bit set in a non-zero word.
+     * @param word The word to find the bit in.
+     * @return The index of the lowest bit set.
+     */
+    inline size_t ctz(uint64_t word) noexcept
+    {
+      #if (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_GCC) || (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_CLANG)
+        return (size_t) __builtin_ctzll(word);
+      #else
+        size_t index = 0;
+        for (; !(word & 1); word >>= 1) ++index;
+        return index;
+      #endif
+    }
+
+    /**
+     * Appends a trivially copyable value's bytes to a staging buffer.
+     * @tparam T The value's type.
+     * @param out The staging buffer to append to.
+     * @param value The value to be appended.
+     */
+    template <typename T>
+    inline void append(std::vector<std::byte>& out, const T& value)
+    {
+        const size_t offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+}
+
+/**
+ * A structure-of-arrays table which tracks the blocks of its columns changed since
+ * the last checkpoint. Every write must go through the table, which marks the
+ * fixed-size blocks of rows it touches as dirty, so that an incremental checkpoint
+ * writes only the blocks which have actually changed. A table is restored by
+ * replaying a full checkpoint followed by its incremental ones, in order.
+ * @tparam T The tuple's element types.
+ * @since 1.0
+ */
+template <typename ...T>
+class tracked_soa_t
+{
+    static_assert((std::is_trivially_copyable_v<T> && ...)
+      , "only columns of trivially copyable elements can be checkpointed");
+
+    public:
+        typedef soa_t<T...> table_t;
+        typedef typename table_t::row_t row_t;
+
+        static constexpr size_t count = sizeof...(T);
+
+    private:
+        typedef std::make_index_sequence<count> indexer_t;
+        static constexpr size_t staging = size_t(4) << 20;
+
+    private:
+        table_t m_table;
+        size_t m_block;
+        std::vector<uint64_t> m_dirty[count];
+
+    public:
+        inline tracked_soa_t(const tracked_soa_t&) = default;
+        inline tracked_soa_t(tracked_soa_t&&) noexcept = default;
+
+        /**
+         * Creates a table with the given number of value-initialized rows, which are
+         * all dirty as they have never been checkpointed.
+         * @param n The number of rows in the table.
+         * @param block The number of rows in each tracked block.
+         */
+        inline explicit tracked_soa_t(size_t n = 0, size_t block = 4096)
+          : m_block (std::max<size_t>(1, block))
+        {
+            resize(n);
+        }
+
+        inline tracked_soa_t& operator=(const tracked_soa_t&) = default;
+        inline tracked_soa_t& operator=(tracked_soa_t&&) noexcept = default;
+
+        /**
+         * Retrieves the underlying table for reading.
+         * @return The const-qualified table.
+         */
+        inline const table_t& table() const noexcept
+        {
+            return m_table;
+        }
+
+        /**
+         * Retrieves one of the table's const-qualified columns.
+         * @tparam I The index of the column to be retrieved.
+         * @return The column's contiguous sequence.
+         */
+        template <size_t I>
+        inline decltype(auto) column() const noexcept
+        {
+            return m_table.template column<I>();
+        }
+
+        /**
+         * Retrieves an element for writing, marking its block as dirty.
+         * @tparam I The index of the element's column.
+         * @param i The index of the element's row.
+         * @return The mutable reference to the element.
+         */
+        template <size_t I>
+        inline auto at(size_t i) noexcept -> tuple_element_t<row_t, I>&
+        {
+            mark<I>(i, i + 1);
+            return m_table.template column<I>()[i];
+        }
+
+        /**
+         * Retrieves a range of a column for writing, marking its blocks as dirty.
+         * @tparam I The index of the column.
+         * @param first The first row of the range.
+         * @param last The end of the range.
+         * @return The pointer to the range's first element.
+         */
+        template <size_t I>
+        inline auto span(size_t first, size_t last) noexcept -> tuple_element_t<row_t, I>*
+        {
+            mark<I>(first, last);
+            return m_table.template column<I>().data() + first;
+        }
+
+        /**
+         * Overwrites a whole row, marking its block as dirty in all columns.
+         * @tparam U The row's tuple type.
+         * @param i The index of the row to be overwritten.
+         * @param t The row's new elements.
+         */
+        template <typename U>
+        inline void assign(size_t i, const U& t)
+        {
+            static_assert(U::count == count, "assigned rows must have all elements");
+            assign(i, t, indexer_t());
+        }
+
+        /**
+         * Appends a row to the table, marking its block as dirty in all columns.
+         * @tparam U The appended tuple type.
+         * @param t The tuple to be appended.
+         */
+        template <typename U>
+        inline void push_back(const U& t)
+        {
+            m_table.push_back(t);
+            track(m_table.size() - 1, m_table.size());
+        }
+
+        /**
+         * Resizes the table, marking the blocks of any new rows as dirty.
+         * @param n The new number of rows.
+         */
+        inline void resize(size_t n)
+        {
+            const size_t previous = m_table.size();
+            m_table.resize(n);
+            track(std::min(previous, n), n);
+        }
+
+        /**
+         * Informs the number of rows in the table.
+         * @return The table's number of rows.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_table.size();
+        }
+
+        /**
+         * Informs the number of rows in each tracked block.
+         * @return The table's block size.
+         */
+        inline size_t block() const noexcept
+        {
+            return m_block;
+        }
+
+        /**
+         * Counts the dirty blocks over all columns.
+         * @return The number of blocks to be written by an incremental checkpoint.
+         */
+        inline size_t dirty() const noexcept
+        {
+            size_t total = 0;
+            for (const auto& bits : m_dirty)
+                for (uint64_t word : bits) total += detail::popcount(word);
+            return total;
+        }
+
+        /**
+         * Writes a checkpoint of the table to a file, and marks all blocks as clean.
+         * An incremental checkpoint only holds the blocks changed since the previous
+         * checkpoint, while a full one holds all blocks and may be restored alone.
+         * @param path The path of the checkpoint file to be written.
+         * @param full Must all blocks be written, regardless of being dirty?
+         * @return The number of bytes written.
+         */
+        inline size_t checkpoint(const std::string& path, bool full = false)
+        {
+            const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+            if (fd < 0)
+                throw std::system_error(errno, std::generic_category(), "cannot open checkpoint file");
+
+            try {
+                const size_t written = checkpoint(fd, full);
+                ::close(fd);
+                return written;
+            } catch (...) {
+                ::close(fd);
+                throw;
+            }
+        }
+
+        /**
+         * Writes a checkpoint of the table to an open file, from its current offset,
+         * and moves the offset past it. Thus, successive checkpoints written to the
+         * same file are restored by successive restores from the file.
+         * @param fd The file descriptor to write the checkpoint to.
+         * @param full Must all blocks be written, regardless of being dirty?
+         * @return The number of bytes written.
+         */
+        inline size_t checkpoint(int fd, bool full = false)
+        {
+            std::vector<std::byte> buffer;
+            size_t offset = detail::tell(fd);
+            const size_t start = offset;
+
+            detail::checkpoint_header_t header;
+            header.columns = (uint32_t) count;
+            header.rows = size();
+            header.block = m_block;
+
+            detail::append(buffer, header);
+            (detail::append(buffer, (uint64_t) sizeof(T)), ...);
+
+            auto flush = [&]() {
+                io::write_at(fd, buffer.data(), buffer.size(), offset);
+                offset += buffer.size();
+                buffer.clear();
+            };
+
+            for_each([&](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                auto& bits = m_dirty[I];
+                const auto& column = m_table.template column<I>();
+                const size_t blocks = (size() + m_block - 1) / m_block;
+
+                for (size_t w = 0; w < bits.size(); ++w) {
+                    uint64_t word = full ? ~uint64_t(0) : bits[w];
+                    bits[w] = 0;
+
+                    for (; word != 0; word &= word - 1) {
+                        const size_t b = w * 64 + detail::ctz(word);
+                        if (b >= blocks) break;
+
+                        const size_t first = b * m_block;
+                        const size_t bytes = (std::min(first + m_block, size()) - first) * sizeof(column[0]);
+
+                        detail::append(buffer, detail::checkpoint_block_t {I, b});
+                        if (buffer.size() + bytes > staging) flush();
+                        ++header.blocks;
+
+                        if (bytes > staging) {
+                            io::write_at(fd, reinterpret_cast<const std::byte*>(column.data() + first), bytes, offset);
+                            offset += bytes;
+                        } else {
+                            const size_t position = buffer.size();
+                            buffer.resize(position + bytes);
+                            std::memcpy(buffer.data() + position, column.data() + first, bytes);
+                        }
+                    }
+                }
+            });
+
+            flush();
+
+            // The number of blocks is only known once all of them have been written,
+            // so the checkpoint's header is written once again to record it.
+            io::write_at(fd, reinterpret_cast<const std::byte*>(&header), sizeof(header), start);
+            detail::seek(fd, offset);
+
+            return offset - start;
+        }
+
+        /**
+         * Applies a checkpoint file to the table. The table takes the size recorded
+         * in the checkpoint, and all blocks in it are overwritten. After the restore,
+         * all blocks are clean.
+         * @param path The path of the checkpoint file to be applied.
+         */
+        inline void restore(const std::string& path)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+            if (fd < 0)
+                throw std::system_error(errno, std::generic_category(), "cannot open checkpoint file");
+
+            try {
+                restore(fd);
+                ::close(fd);
+            } catch (...) {
+                ::close(fd);
+                throw;
+            }
+        }
+
+        /**
+         * Restores the table by replaying a full checkpoint and then its incremental
+         * checkpoints, in the order they have been written.
+         * @param paths The checkpoint files, from the full one onwards.
+         */
+        inline void restore(std::initializer_list<std::string> paths)
+        {
+            for (const auto& path : paths)
+                restore(path);
+        }
+
+        /**
+         * Applies a checkpoint from an open file, read from its current offset, and
+         * moves the offset past it, to where a following checkpoint would start.
+         * @param fd The file descriptor to read the checkpoint from.
+         */
+        inline void restore(int fd)
+        {
+            detail::checkpoint_header_t header;
+            uint64_t sizes[count];
+            size_t offset = detail::tell(fd);
+
+            auto read = [&](void *data, size_t bytes) {
+                if (io::read_at(fd, static_cast<std::byte*>(data), bytes, offset) < bytes)
+                    throw std::runtime_error("checkpoint file is truncated");
+                offset += bytes;
+            };
+
+            read(&header, sizeof(header));
+            read(sizes, sizeof(sizes));
+
+            const uint64_t expected[] = {sizeof(T)...};
+
+            if (header.magic != detail::checkpoint_header_t::signature || header.columns != count || header.block == 0)
+                throw std::runtime_error("malformed checkpoint file");
+            if (!std::equal(sizes, sizes + count, expected))
+                throw std::runtime_error("checkpoint file does not match the table's columns");
+
+            m_table.resize(header.rows);
+
+            for (uint64_t k = 0; k < header.blocks; ++k) {
+                detail::checkpoint_block_t block;
+                read(&block, sizeof(block));
+
+                const size_t first = block.index * header.block;
+                if (block.column >= count || first >= header.rows)
+                    throw std::runtime_error("malformed checkpoint file");
+
+                const size_t rows = std::min<size_t>(first + header.block, header.rows) - first;
+
+                for_each([&](auto index) {
+                    constexpr size_t I = decltype(index)::value;
+                    if (block.column == I) read(m_table.template column<I>().data() + first, rows * sizeof(tuple_element_t<row_t, I>));
+                });
+            }
+
+            for (auto& bits : m_dirty)
+                bits.assign((size() + m_block - 1) / m_block / 64 + 1, 0);
+
+            detail::seek(fd, offset);
+        }
+
+    private:
+        /**
+         * Marks the blocks of a range of rows of a column as dirty.
+         * @tparam I The index of the column.
+         * @param first The first row of the range.
+         * @param last The end of the range.
+         */
+        template <size_t I>
+        inline void mark(size_t first, size_t last) noexcept
+        {
+            auto& bits = m_dirty[I];
+            if (first >= last) return;
+
+            for (size_t b = first / m_block, e = (last - 1) / m_block; b <= e; ++b)
+                bits[b / 64] |= uint64_t(1) << (b % 64);
+        }
+
+        /**
+         * Grows the dirty bitsets to the table's size and marks a range of rows of all
+         * columns as dirty.
+         * @param first The first row of the range.
+         * @param last The end of the range.
+         */
+        inline void track(size_t first, size_t last)
+        {
+            const size_t words = (size() + m_block - 1) / m_block / 64 + 1;
+
+            for_each([&](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                if (m_dirty[I].size() < words) m_dirty[I].resize(words, 0);
+                mark<I>(first, last);
+            });
+        }
+
+        /**
+         * Overwrites a row's elements, marking their blocks as dirty.
+         * @tparam U The row's tuple type.
+         * @tparam I The tuple's sequence indeces.
+         * @param i The index of the row to be overwritten.
+         * @param t The row's new elements.
+         */
+        template <typename U, size_t ...I>
+        inline void assign(size_t i, const U& t, std::index_sequence<I...>)
+        {
+            ((at<I>(i) = operation::get<I>(t)), ...);
+        }
+
+        /**
+         * Invokes a functor with the compile-time index of each column.
+         * @tparam F The functor type.
+         * @param lambda The functor to be invoked.
+         */
+        template <typename F>
+        inline static void for_each(F&& lambda)
+        {
+            for_each(lambda, indexer_t());
+        }
+
+        /**
+         * Invokes a functor with the compile-time index of each column.
+         * @tparam F The functor type.
+         * @tparam I The columns' sequence indeces.
+         * @param lambda The functor to be invoked.
+         */
+        template <typename F, size_t ...I>
+        inline static void for_each(F& lambda, std::index_sequence<I...>)
+        {
+            (lambda(std::integral_constant<size_t, I>()), ...);
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
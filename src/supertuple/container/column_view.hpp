@@ -0,0 +1,376 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The strided column views over arrays of tuples implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The number of independent accumulators used by the scalar kernels over strided
+     * columns, so that consecutive loads do not wait on each other.
+     * @since 1.0
+     */
+    inline constexpr size_t column_unroll = 4;
+
+    /**
+     * Advances a pointer by a number of bytes, keeping its type.
+     * @tparam E The pointed element's type.
+     * @param ptr The pointer to be advanced.
+     * @param bytes The number of bytes to advance by.
+     * @return The advanced pointer.
+     */
+    template <typename E>
+    inline E *offset_by(E *ptr, std::ptrdiff_t bytes) noexcept
+    {
+        using byte_t = std::conditional_t<std::is_const_v<E>, const char, char>;
+        return reinterpret_cast<E*>(reinterpret_cast<byte_t*>(ptr) + bytes);
+    }
+
+    /**
+     * The type of sums of column elements. Integers are summed in 64 bits, so that
+     * columns of narrow integers do not overflow, while other elements are summed
+     * in the type their addition produces.
+     * @tparam T The column's elements' type.
+     * @since 1.0
+     */
+    template <typename T, typename = void>
+    struct column_sum
+    {
+        typedef decltype(std::declval<const T&>() + std::declval<const T&>()) type;
+    };
+
+    template <typename T>
+    struct column_sum<T, std::enable_if_t<std::is_integral_v<T>>>
+    {
+        typedef std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t> type;
+    };
+}
+
+/**
+ * A random-access view of a single element of each tuple in an array of tuples.
+ * As all tuples in the array have the same layout, the element lies at the same
+ * offset within each one of them, so the view only keeps a pointer to the first
+ * tuple's element and the tuples' size as the stride between consecutive elements.
+ * Aggregations over the view gather whole vectors of elements at once, or keep
+ * several independent accumulators, so that strided loads are not serialized.
+ * @tparam E The viewed element's possibly const-qualified type.
+ * @since 1.0
+ */
+template <typename E>
+class column_view_t
+{
+    public:
+        typedef std::remove_const_t<E> value_t;
+
+        /**
+         * An iterator over the elements of a column view.
+         * @since 1.0
+         */
+        class iterator_t
+        {
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = value_t;
+                using difference_type = std::ptrdiff_t;
+                using pointer = E*;
+                using reference = E&;
+
+            private:
+                E *m_ptr = nullptr;
+                std::ptrdiff_t m_stride = 0;
+
+            public:
+                inline iterator_t() noexcept = default;
+
+                /**
+                 * Creates an iterator pointing to an element of the column.
+                 * @param ptr The element pointed to by the iterator.
+                 * @param stride The distance, in bytes, between consecutive elements.
+                 */
+                inline iterator_t(E *ptr, std::ptrdiff_t stride) noexcept
+                  : m_ptr (ptr)
+                  , m_stride (stride)
+                {}
+
+                inline reference operator*() const noexcept { return *m_ptr; }
+                inline pointer operator->() const noexcept { return m_ptr; }
+                inline reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+                inline iterator_t& operator++() noexcept { return *this += 1; }
+                inline iterator_t& operator--() noexcept { return *this -= 1; }
+                inline iterator_t operator++(int) noexcept { auto copy = *this; ++*this; return copy; }
+                inline iterator_t operator--(int) noexcept { auto copy = *this; --*this; return copy; }
+
+                /**
+                 * Advances the iterator by a number of elements.
+                 * @param n The number of elements to advance by.
+                 * @return The advanced iterator.
+                 */
+                inline iterator_t& operator+=(difference_type n) noexcept
+                {
+                    m_ptr = detail::offset_by(m_ptr, n * m_stride);
+                    return *this;
+                }
+
+                inline iterator_t& operator-=(difference_type n) noexcept { return *this += -n; }
+                inline iterator_t operator+(difference_type n) const noexcept { auto copy = *this; return copy += n; }
+                inline iterator_t operator-(difference_type n) const noexcept { auto copy = *this; return copy -= n; }
+                inline friend iterator_t operator+(difference_type n, const iterator_t& it) noexcept { return it + n; }
+
+                /**
+                 * Informs the number of elements between two iterators.
+                 * @param other The iterator to measure the distance from.
+                 * @return The number of elements between the iterators.
+                 */
+                inline difference_type operator-(const iterator_t& other) const noexcept
+                {
+                    if (m_stride == 0) return 0;
+                    using byte_t = std::conditional_t<std::is_const_v<E>, const char, char>;
+                    return (reinterpret_cast<byte_t*>(m_ptr) - reinterpret_cast<byte_t*>(other.m_ptr)) / m_stride;
+                }
+
+                inline bool operator==(const iterator_t& other) const noexcept { return m_ptr == other.m_ptr; }
+                inline bool operator!=(const iterator_t& other) const noexcept { return m_ptr != other.m_ptr; }
+                inline bool operator<(const iterator_t& other) const noexcept { return (*this - other) < 0; }
+                inline bool operator>(const iterator_t& other) const noexcept { return other < *this; }
+                inline bool operator<=(const iterator_t& other) const noexcept { return !(other < *this); }
+                inline bool operator>=(const iterator_t& other) const noexcept { return !(*this < other); }
+        };
+
+    private:
+        E *m_data = nullptr;
+        size_t m_count = 0;
+        std::ptrdiff_t m_stride = 0;
+
+    public:
+        inline column_view_t() noexcept = default;
+        inline column_view_t(const column_view_t&) noexcept = default;
+        inline column_view_t(column_view_t&&) noexcept = default;
+
+        /**
+         * Creates a view over a column of elements.
+         * @param data The column's first element.
+         * @param count The number of elements in the column.
+         * @param stride The distance, in bytes, between consecutive elements.
+         */
+        inline column_view_t(E *data, size_t count, std::ptrdiff_t stride) noexcept
+          : m_data (data)
+          , m_count (count)
+          , m_stride (stride)
+        {}
+
+        inline column_view_t& operator=(const column_view_t&) noexcept = default;
+        inline column_view_t& operator=(column_view_t&&) noexcept = default;
+
+        /**
+         * Retrieves an element of the column.
+         * @param i The index of the tuple to retrieve the element of.
+         * @return The tuple's element.
+         */
+        inline E& operator[](size_t i) const noexcept
+        {
+            return *detail::offset_by(m_data, (std::ptrdiff_t) i * m_stride);
+        }
+
+        inline iterator_t begin() const noexcept { return iterator_t(m_data, m_stride); }
+        inline iterator_t end() const noexcept { return begin() + (std::ptrdiff_t) m_count; }
+
+        inline size_t size() const noexcept { return m_count; }
+        inline bool empty() const noexcept { return m_count == 0; }
+        inline std::ptrdiff_t stride() const noexcept { return m_stride; }
+
+        /**
+         * Sums all elements of the column. Integers are summed in 64 bits, and other
+         * elements in the type of their addition. Floating-point elements are summed
+         * in a different order than a plain loop would, so results may differ by rounding.
+         * @return The sum of the column's elements.
+         */
+        inline auto sum() const noexcept
+        {
+            using sum_t = typename detail::column_sum<value_t>::type;
+
+            sum_t total {};
+            size_t i = 0;
+
+          #if defined(SUPERTUPLE_SIMD_ENABLED)
+            if constexpr (vectorizable && detail::simd::vectorizable_v<sum_t>) {
+                using vector_t = detail::simd::vector_t<sum_t>;
+                constexpr size_t lanes = sizeof(vector_t) / sizeof(sum_t);
+
+                vector_t acc {};
+                for (; i + lanes <= m_count; i += lanes) acc += gather<vector_t>(i, std::make_index_sequence<lanes>());
+                for (size_t j = 0; j < lanes; ++j) total += acc[j];
+            }
+          #endif
+
+            sum_t partial[detail::column_unroll] = {};
+
+            for (; i + detail::column_unroll <= m_count; i += detail::column_unroll)
+                for (size_t j = 0; j < detail::column_unroll; ++j)
+                    partial[j] += operator[](i + j);
+
+            for (; i < m_count; ++i) total += operator[](i);
+            for (const auto& value : partial) total += value;
+
+            return total;
+        }
+
+        /**
+         * Finds the least element of the column. NaNs are ignored.
+         * @return The column's least element, or the greatest representable value
+         * if there is no such element.
+         */
+        inline value_t min() const noexcept
+        {
+            return extreme<false>();
+        }
+
+        /**
+         * Finds the greatest element of the column. NaNs are ignored.
+         * @return The column's greatest element, or the least representable value
+         * if there is no such element.
+         */
+        inline value_t max() const noexcept
+        {
+            return extreme<true>();
+        }
+
+        /**
+         * Counts the elements of the column which satisfy a predicate.
+         * @tparam P The predicate's type.
+         * @param predicate The predicate to test the elements with.
+         * @return The number of elements satisfying the predicate.
+         */
+        template <typename P>
+        inline size_t count_if(P&& predicate) const
+        {
+            size_t partial[detail::column_unroll] = {};
+            size_t total = 0, i = 0;
+
+            for (; i + detail::column_unroll <= m_count; i += detail::column_unroll)
+                for (size_t j = 0; j < detail::column_unroll; ++j)
+                    partial[j] += predicate(operator[](i + j)) ? 1 : 0;
+
+            for (; i < m_count; ++i) total += predicate(operator[](i)) ? 1 : 0;
+            for (size_t value : partial) total += value;
+
+            return total;
+        }
+
+    private:
+        /**
+         * Whether the column's elements can be gathered into vector lanes.
+         * @since 1.0
+         */
+        static constexpr bool vectorizable = detail::simd::vectorizable_v<value_t>;
+
+      #if defined(SUPERTUPLE_SIMD_ENABLED)
+        /**
+         * Gathers consecutive elements of the column into the lanes of a vector.
+         * @tparam V The vector type to gather the elements into.
+         * @tparam J The vector's lane indeces.
+         * @param i The index of the first element to be gathered.
+         * @return The vector of gathered elements.
+         */
+        template <typename V, size_t ...J>
+        inline V gather(size_t i, std::index_sequence<J...>) const noexcept
+        {
+            const E *base = &operator[](i);
+            return V {*detail::offset_by(base, (std::ptrdiff_t) J * m_stride)...};
+        }
+      #endif
+
+        /**
+         * Finds the least or the greatest element of the column.
+         * @tparam G Must the greatest element be found instead of the least?
+         * @return The column's extreme element.
+         */
+        template <bool G>
+        inline value_t extreme() const noexcept
+        {
+            static_assert(std::is_arithmetic_v<value_t>, "only arithmetic columns have extremes");
+
+            using limits_t = std::numeric_limits<value_t>;
+            constexpr bool floating = std::is_floating_point_v<value_t>;
+
+            value_t best = G ? (floating ? -limits_t::infinity() : limits_t::lowest())
+                             : (floating ?  limits_t::infinity() : limits_t::max());
+
+            auto better = [](const value_t& a, const value_t& b) { return G ? b < a : a < b; };
+            size_t i = 0;
+
+          #if defined(SUPERTUPLE_SIMD_ENABLED)
+            if constexpr (vectorizable) {
+                using vector_t = detail::simd::vector_t<value_t>;
+                using mask_t = detail::simd::mask_t<value_t>;
+                constexpr size_t lanes = sizeof(vector_t) / sizeof(value_t);
+
+                auto acc = detail::simd::broadcast<vector_t>(best);
+
+                for (; i + lanes <= m_count; i += lanes) {
+                    const auto v = gather<vector_t>(i, std::make_index_sequence<lanes>());
+                    if constexpr (G) acc = detail::simd::select((mask_t) (v > acc), v, acc);
+                    else             acc = detail::simd::select((mask_t) (v < acc), v, acc);
+                }
+
+                for (size_t j = 0; j < lanes; ++j)
+                    if (better(acc[j], best)) best = acc[j];
+            }
+          #endif
+
+            for (; i < m_count; ++i)
+                if (better(operator[](i), best)) best = operator[](i);
+
+            return best;
+        }
+};
+
+/**
+ * Creates a view over an element of each tuple in an array of tuples.
+ * @tparam I The index of the viewed element.
+ * @tparam T The array's tuple type.
+ * @param data The array's first tuple.
+ * @param count The number of tuples in the array.
+ * @return The strided view over the tuples' elements.
+ */
+template <size_t I, typename T>
+inline auto column_view(T *data, size_t count) noexcept
+{
+    using element_t = std::remove_reference_t<decltype(operation::get<I>(*data))>;
+    element_t *first = count > 0 ? &operation::get<I>(*data) : nullptr;
+    return column_view_t<element_t>(first, count, (std::ptrdiff_t) sizeof(T));
+}
+
+/**
+ * Creates a view over an element of each tuple in a contiguous container of tuples,
+ * such as a vector or an array.
+ * @tparam I The index of the viewed element.
+ * @tparam C The container's type.
+ * @param container The container of tuples.
+ * @return The strided view over the tuples' elements.
+ */
+template <size_t I, typename C, typename = decltype(std::declval<C&>().data())>
+inline auto column_view(C& container) noexcept
+{
+    return column_view<I>(container.data(), container.size());
+}
+
+SUPERTUPLE_END_NAMESPACE
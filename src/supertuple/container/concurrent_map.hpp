@@ -0,0 +1,491 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The lock-striped concurrent hash map keyed by tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/hash.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+template <typename K, typename V>
+class concurrent_tuple_map;
+
+/**
+ * A hash map keyed by tuples, shared by many threads. The map is split into shards,
+ * chosen by the high bits of the keys' hashes, each one an open-addressing table
+ * with linear probing and its own lock, so that writers of different shards never
+ * contend. Each shard also has a version stamp, which is odd while it is written
+ * to: when keys and values are trivially copyable, readers take no lock at all, but
+ * copy the value they look for and retry if the stamp has changed meanwhile. As
+ * such readers may still be probing a table while it is grown, a shard keeps its
+ * outgrown tables until the map is cleared or destroyed. Keys can be looked up by
+ * any tuple which hashes and compares equally, such as one created by `tie`.
+ * @tparam K The key tuple's element types.
+ * @tparam V The mapped value type.
+ * @since 1.0
+ */
+template <typename ...K, typename V>
+class concurrent_tuple_map<tuple_t<K...>, V>
+{
+    static_assert(std::is_default_constructible_v<V>, "mapped values must be default constructible");
+
+    public:
+        typedef tuple_t<K...> key_t;
+        typedef V value_t;
+
+    private:
+        /**
+         * Readers are only lock-free when copying a slot that is concurrently written
+         * to cannot break any invariant of the copy.
+         * @since 1.0
+         */
+        static constexpr bool optimistic =
+            (std::is_trivially_copyable_v<K> && ...) && std::is_trivially_copyable_v<V>;
+
+        /**
+         * A table slot, which is empty while its hash is zero.
+         * @since 1.0
+         */
+        struct slot_t
+        {
+            uint64_t hash = 0;
+            key_t key {};
+            V value {};
+        };
+
+        /**
+         * An open-addressing table with a power-of-two number of slots.
+         * @since 1.0
+         */
+        struct table_t
+        {
+            size_t mask;
+            std::unique_ptr<slot_t[]> slots;
+
+            inline explicit table_t(size_t capacity)
+              : mask (capacity - 1)
+              , slots (new slot_t[capacity])
+            {}
+        };
+
+        /**
+         * A shard of the map, aligned to its own cache line so that the locks and
+         * stamps of different shards never share a line.
+         * @since 1.0
+         */
+        struct alignas(64) shard_t
+        {
+            std::atomic<uint64_t> version {0};
+            std::atomic<table_t*> table {nullptr};
+            std::atomic<size_t> count {0};
+            std::mutex lock;
+            std::vector<std::unique_ptr<table_t>> tables;
+        };
+
+        /**
+         * Stamps a write to a shard, keeping its version odd while the stamp is alive.
+         * The new even version is published when the stamp is destroyed, even if the
+         * write throws, so that readers are never left waiting for it.
+         * @since 1.0
+         */
+        class stamp_t
+        {
+            private:
+                shard_t& m_shard;
+                uint64_t m_version;
+
+            public:
+                inline stamp_t(const stamp_t&) noexcept = delete;
+                inline stamp_t(stamp_t&&) noexcept = delete;
+
+                /**
+                 * Starts a write to a shard, making its version stamp odd.
+                 * @param shard The shard being written to.
+                 */
+                inline explicit stamp_t(shard_t& shard) noexcept
+                  : m_shard (shard)
+                  , m_version (shard.version.load(std::memory_order_relaxed))
+                {
+                    m_shard.version.store(m_version + 1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+                }
+
+                /**
+                 * Finishes the write, publishing a new even version stamp.
+                 */
+                inline ~stamp_t()
+                {
+                    m_shard.version.store(m_version + 2, std::memory_order_release);
+                }
+
+                inline stamp_t& operator=(const stamp_t&) noexcept = delete;
+                inline stamp_t& operator=(stamp_t&&) noexcept = delete;
+        };
+
+    private:
+        size_t m_bits;
+        std::unique_ptr<shard_t[]> m_shards;
+
+    public:
+        inline concurrent_tuple_map(const concurrent_tuple_map&) = delete;
+        inline concurrent_tuple_map(concurrent_tuple_map&&) = delete;
+
+        /**
+         * Creates an empty map with the given number of shards.
+         * @param shards The minimum number of shards, rounded up to a power of two.
+         * @param capacity The initial number of slots of each shard.
+         */
+        inline explicit concurrent_tuple_map(size_t shards = 64, size_t capacity = 16)
+          : m_bits (0)
+        {
+            while ((size_t(1) << m_bits) < shards && m_bits < 16) ++m_bits;
+            m_shards.reset(new shard_t[size_t(1) << m_bits]);
+
+            size_t slots = 8;
+            while (slots < capacity) slots <<= 1;
+
+            for (size_t s = 0; s < (size_t(1) << m_bits); ++s) {
+                m_shards[s].tables.push_back(std::make_unique<table_t>(slots));
+                m_shards[s].table.store(m_shards[s].tables.back().get(), std::memory_order_release);
+            }
+        }
+
+        inline concurrent_tuple_map& operator=(const concurrent_tuple_map&) = delete;
+        inline concurrent_tuple_map& operator=(concurrent_tuple_map&&) = delete;
+
+        /**
+         * Searches for a key and copies its mapped value.
+         * @tparam U The searched key's tuple type.
+         * @param key The key to be searched, possibly a tuple of references.
+         * @return The key's mapped value, if the key is in the map.
+         */
+        template <typename U>
+        inline std::optional<V> find(const U& key) const
+        {
+            const uint64_t hash = hash_of(key);
+            shard_t& shard = shard_of(hash);
+
+            if constexpr (optimistic) {
+                for (;;) {
+                    const uint64_t version = shard.version.load(std::memory_order_acquire);
+
+                    if (version & 1) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    std::optional<V> result;
+                    if (peek(shard, version, hash, key, result))
+                        return result;
+                }
+            } else {
+                std::lock_guard guard (shard.lock);
+                const slot_t *slot = probe(*shard.table.load(std::memory_order_relaxed), hash, key);
+                return slot != nullptr ? std::optional<V>(slot->value) : std::nullopt;
+            }
+        }
+
+        /**
+         * Checks whether a key is in the map.
+         * @tparam U The searched key's tuple type.
+         * @param key The key to be searched, possibly a tuple of references.
+         * @return Is the key in the map?
+         */
+        template <typename U>
+        inline bool contains(const U& key) const
+        {
+            return find(key).has_value();
+        }
+
+        /**
+         * Inserts a key with its mapped value, unless the key is already in the map.
+         * @param key The key to be inserted.
+         * @param value The key's mapped value.
+         * @return Has the key been inserted?
+         */
+        inline bool insert(const key_t& key, const V& value)
+        {
+            return write(key, [&](V& target, bool inserted) { if (inserted) target = value; });
+        }
+
+        /**
+         * Inserts a key with its mapped value, or overwrites its value if the key is
+         * already in the map.
+         * @param key The key to be inserted or assigned.
+         * @param value The key's mapped value.
+         * @return Has the key been inserted?
+         */
+        inline bool insert_or_assign(const key_t& key, const V& value)
+        {
+            return write(key, [&](V& target, bool) { target = value; });
+        }
+
+        /**
+         * Applies an update in place to a key's mapped value, inserting the key with
+         * a value-initialized value beforehand if it is not in the map. The update is
+         * atomic with respect to all other operations on the key, and must not access
+         * the map itself. If the update throws, the key is kept with whatever value
+         * the update has left it with.
+         * @tparam F The update functor type.
+         * @param key The key to be updated.
+         * @param lambda The update, invoked with a mutable reference to the value.
+         * @return Has the key been inserted?
+         */
+        template <typename F>
+        inline bool upsert(const key_t& key, F&& lambda)
+        {
+            return write(key, [&](V& target, bool) { lambda(target); });
+        }
+
+        /**
+         * Removes a key from the map. The following slots of the probe sequence are
+         * shifted backwards, so that no tombstones are ever left behind.
+         * @tparam U The removed key's tuple type.
+         * @param key The key to be removed, possibly a tuple of references.
+         * @return Has the key been removed?
+         */
+        template <typename U>
+        inline bool erase(const U& key)
+        {
+            const uint64_t hash = hash_of(key);
+            shard_t& shard = shard_of(hash);
+            std::lock_guard guard (shard.lock);
+
+            table_t& table = *shard.table.load(std::memory_order_relaxed);
+            slot_t *slot = const_cast<slot_t*>(probe(table, hash, key));
+            if (slot == nullptr) return false;
+
+            stamp_t stamp (shard);
+
+            for (size_t i = (size_t) (slot - table.slots.get()), j = i; ; ) {
+                j = (j + 1) & table.mask;
+                slot_t& next = table.slots[j];
+
+                if (next.hash == 0) {
+                    table.slots[i] = slot_t();
+                    break;
+                }
+
+                // An entry may only be shifted back to the freed slot if the slot lies
+                // between the entry's home and its current position, cyclically.
+                const size_t home = next.hash & table.mask;
+                if (((j - home) & table.mask) >= ((j - i) & table.mask)) {
+                    table.slots[i] = std::move(next);
+                    i = j;
+                }
+            }
+
+            shard.count.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * Informs the number of keys in the map. The count is only exact when there
+         * are no concurrent writers.
+         * @return The map's number of keys.
+         */
+        inline size_t size() const noexcept
+        {
+            size_t total = 0;
+            for (size_t s = 0; s < (size_t(1) << m_bits); ++s)
+                total += m_shards[s].count.load(std::memory_order_relaxed);
+            return total;
+        }
+
+        /**
+         * Removes all keys from the map and releases all outgrown tables. Unlike the
+         * other operations, clearing must not be concurrent with any other one.
+         */
+        inline void clear()
+        {
+            for (size_t s = 0; s < (size_t(1) << m_bits); ++s) {
+                shard_t& shard = m_shards[s];
+                const size_t capacity = shard.tables.front()->mask + 1;
+                shard.tables.clear();
+                shard.tables.push_back(std::make_unique<table_t>(capacity));
+                shard.table.store(shard.tables.back().get(), std::memory_order_release);
+                shard.count.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        /**
+         * Hashes a key, reserving the zero hash for empty slots.
+         * @tparam U The key's tuple type.
+         * @param key The key to be hashed.
+         * @return The key's hash value.
+         */
+        template <typename U>
+        inline static uint64_t hash_of(const U& key)
+        {
+            const uint64_t hash = operation::hash(key);
+            return hash != 0 ? hash : 1;
+        }
+
+        /**
+         * Retrieves the shard a hash belongs to, by the hash's high bits.
+         * @param hash The key's hash value.
+         * @return The key's shard.
+         */
+        inline shard_t& shard_of(uint64_t hash) const noexcept
+        {
+            return m_shards[m_bits > 0 ? (size_t) (hash >> (64 - m_bits)) : 0];
+        }
+
+        /**
+         * Searches for a key in a shard's current table without taking its lock. The
+         * hash and key of each probed slot are copied and the shard's version checked
+         * before they are compared, so that a slot torn by a concurrent write is never
+         * compared with the key. The number of probes is bounded, so that the reader
+         * never loops indefinitely on a table being modified.
+         * @tparam U The key's tuple type.
+         * @param shard The shard to be searched.
+         * @param version The shard's even version when the search started.
+         * @param hash The key's hash value.
+         * @param key The key to be searched.
+         * @param result The key's mapped value, if the key is in the shard.
+         * @return Has the shard been left unchanged during the search?
+         */
+        template <typename U>
+        inline static bool peek(
+            const shard_t& shard, uint64_t version, uint64_t hash, const U& key
+          , std::optional<V>& result
+        ) {
+            const table_t& table = *shard.table.load(std::memory_order_acquire);
+
+            for (size_t i = hash & table.mask, n = 0; n <= table.mask; i = (i + 1) & table.mask, ++n) {
+                const slot_t& slot = table.slots[i];
+                const uint64_t seen = slot.hash;
+                const key_t candidate = slot.key;
+
+                if (!unchanged(shard, version)) return false;
+                if (seen == 0) return true;
+
+                if (seen == hash && candidate == key) {
+                    const V value = slot.value;
+                    if (!unchanged(shard, version)) return false;
+                    result = value;
+                    return true;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Checks whether a shard has not been written to since a version was read.
+         * @param shard The shard to be checked.
+         * @param version The shard's previously read version.
+         * @return Is the shard's version still the same?
+         */
+        inline static bool unchanged(const shard_t& shard, uint64_t version) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return shard.version.load(std::memory_order_relaxed) == version;
+        }
+
+        /**
+         * Searches for a key in a table, under the lock of the table's shard.
+         * @tparam U The key's tuple type.
+         * @param table The table to be searched.
+         * @param hash The key's hash value.
+         * @param key The key to be searched.
+         * @return The key's slot, or null if the key is not in the table.
+         */
+        template <typename U>
+        inline static const slot_t *probe(const table_t& table, uint64_t hash, const U& key)
+        {
+            for (size_t i = hash & table.mask, n = 0; n <= table.mask; i = (i + 1) & table.mask, ++n) {
+                const slot_t& slot = table.slots[i];
+                if (slot.hash == 0) return nullptr;
+                if (slot.hash == hash && slot.key == key) return &slot;
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Finds or inserts a key and applies a write to its value, under the lock of
+         * the key's shard. The shard's table is doubled when three quarters full.
+         * @tparam F The write functor type.
+         * @param key The key to be written to.
+         * @param lambda The write, invoked with the value and whether it is new.
+         * @return Has the key been inserted?
+         */
+        template <typename F>
+        inline bool write(const key_t& key, const F& lambda)
+        {
+            const uint64_t hash = hash_of(key);
+            shard_t& shard = shard_of(hash);
+            std::lock_guard guard (shard.lock);
+
+            table_t *table = shard.table.load(std::memory_order_relaxed);
+            slot_t *slot = const_cast<slot_t*>(probe(*table, hash, key));
+            const bool inserted = slot == nullptr;
+            stamp_t stamp (shard);
+
+            if (inserted) {
+                if (4 * (shard.count.load(std::memory_order_relaxed) + 1) > 3 * (table->mask + 1))
+                    table = grow(shard, *table);
+
+                size_t i = hash & table->mask;
+                while (table->slots[i].hash != 0) i = (i + 1) & table->mask;
+
+                slot = &table->slots[i];
+                slot->key = key;
+                slot->hash = hash;
+                shard.count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            lambda(slot->value, inserted);
+            return inserted;
+        }
+
+        /**
+         * Rehashes a shard's table into a new one with twice as many slots. If readers
+         * are lock-free, the outgrown table is kept, as they may still be probing it.
+         * @param shard The shard to be grown.
+         * @param table The shard's current table.
+         * @return The shard's new table.
+         */
+        inline table_t *grow(shard_t& shard, table_t& table)
+        {
+            auto bigger = std::make_unique<table_t>(2 * (table.mask + 1));
+
+            for (size_t j = 0; j <= table.mask; ++j) {
+                slot_t& slot = table.slots[j];
+                if (slot.hash == 0) continue;
+
+                size_t i = slot.hash & bigger->mask;
+                while (bigger->slots[i].hash != 0) i = (i + 1) & bigger->mask;
+                if constexpr (optimistic) bigger->slots[i] = slot;
+                else bigger->slots[i] = std::move(slot);
+            }
+
+            table_t *result = bigger.get();
+            if (!optimistic) shard.tables.clear();
+            shard.tables.push_back(std::move(bigger));
+            shard.table.store(result, std::memory_order_release);
+            return result;
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
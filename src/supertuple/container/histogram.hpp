@@ -0,0 +1,250 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The log-linear latency histogram implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/chunk.hpp>
+#include <supertuple/operation/foreach.hpp>
+#include <supertuple/operation/get.hpp>
+#include <supertuple/operation/scan.hpp>
+#include <supertuple/operation/zipwith.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Finds the highest bit set in a non-zero word.
+     * @param word The word to find the bit in.
+     * @return The index of the highest bit set.
+     */
+    SUPERTUPLE_CONSTEXPR size_t msb(uint64_t word) noexcept
+    {
+      #if (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_GCC) || (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_CLANG)
+        return (size_t) (63 - __builtin_clzll(word));
+      #else
+        size_t index = 0;
+        while (word >>= 1) ++index;
+        return index;
+      #endif
+    }
+
+    /**
+     * Computes the byte offsets of each element of a n-tuple. As elements are base
+     * class subobjects, their offsets are the same for every instance of the type,
+     * and thus can be used to reach an element chosen at run-time.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @tparam I The n-tuple's sequence indeces.
+     * @return The n-tuple's element offsets.
+     */
+    template <typename T, size_t N, size_t ...I>
+    inline std::array<size_t, N> offsets(std::index_sequence<I...>) noexcept
+    {
+        const ntuple_t<T, N> probe {};
+        const auto base = reinterpret_cast<const char*>(&probe);
+        return {{(size_t) (reinterpret_cast<const char*>(&operation::get<I>(probe)) - base)...}};
+    }
+
+    /**
+     * The number of buckets left-scanned at once when computing cumulative counts.
+     * @since 1.0
+     */
+    inline constexpr size_t histogram_chunk = 16;
+}
+
+/**
+ * A histogram of latencies, such as cycle counts or nanoseconds, with log-linear
+ * buckets. Each power of two is split into a fixed number of linear sub-buckets,
+ * so the relative error of any recorded value is bounded by the sub-buckets' count,
+ * while the whole 64-bit range fits in a few hundred counters. Recording is a bit
+ * scan, a few shifts and an increment, and never allocates or synchronizes, so a
+ * histogram is meant to be owned by a single thread and merged with the others'.
+ * @tparam Buckets The number of sub-buckets in each power of two.
+ * @tparam Octaves The number of powers of two above the sub-buckets' count.
+ * @since 1.0
+ */
+template <size_t Buckets = 4, size_t Octaves = 64 - detail::msb(Buckets)>
+class latency_histogram
+{
+    static_assert(Buckets > 0 && (Buckets & (Buckets - 1)) == 0, "sub-buckets must be a power of two");
+    static_assert(Octaves > 0 && Octaves + detail::msb(Buckets) <= 64, "octaves must fit in 64-bit values");
+
+    public:
+        static constexpr size_t count = Buckets * (Octaves + 1);
+        typedef ntuple_t<uint64_t, count> counts_t;
+
+    private:
+        static constexpr size_t shift = detail::msb(Buckets);
+        counts_t m_counts {};
+
+    public:
+        SUPERTUPLE_CONSTEXPR latency_histogram() noexcept = default;
+        SUPERTUPLE_CONSTEXPR latency_histogram(const latency_histogram&) noexcept = default;
+        SUPERTUPLE_CONSTEXPR latency_histogram(latency_histogram&&) noexcept = default;
+
+        SUPERTUPLE_INLINE latency_histogram& operator=(const latency_histogram&) noexcept = default;
+        SUPERTUPLE_INLINE latency_histogram& operator=(latency_histogram&&) noexcept = default;
+
+        /**
+         * Finds the bucket a value is counted in. Values beyond the histogram's last
+         * power of two are counted in the last bucket.
+         * @param value The value to find the bucket of.
+         * @return The value's bucket index.
+         */
+        SUPERTUPLE_CONSTEXPR static size_t bucket(uint64_t value) noexcept
+        {
+            if (value < Buckets) return (size_t) value;
+            const size_t octave = detail::msb(value) - shift;
+            if (octave >= Octaves) return count - 1;
+            return (octave + 1) * Buckets + (size_t) (value >> octave) - Buckets;
+        }
+
+        /**
+         * Informs the lowest value counted in a bucket.
+         * @param index The bucket index.
+         * @return The bucket's lowest value.
+         */
+        SUPERTUPLE_CONSTEXPR static uint64_t lower(size_t index) noexcept
+        {
+            if (index < Buckets) return (uint64_t) index;
+            return (uint64_t) (Buckets + index % Buckets) << (index / Buckets - 1);
+        }
+
+        /**
+         * Informs the highest value counted in a bucket. The last bucket also counts
+         * every value beyond the histogram's range.
+         * @param index The bucket index.
+         * @return The bucket's highest value.
+         */
+        SUPERTUPLE_CONSTEXPR static uint64_t upper(size_t index) noexcept
+        {
+            if (index + 1 >= count) return std::numeric_limits<uint64_t>::max();
+            return lower(index + 1) - 1;
+        }
+
+        /**
+         * Records occurrences of a value.
+         * @param value The value to be recorded.
+         * @param n The number of occurrences to record.
+         */
+        inline void record(uint64_t value, uint64_t n = 1) noexcept
+        {
+            static const auto offsets = detail::offsets<uint64_t, count>(std::make_index_sequence<count>());
+            *reinterpret_cast<uint64_t*>(reinterpret_cast<char*>(&m_counts) + offsets[bucket(value)]) += n;
+        }
+
+        /**
+         * Merges the counts of another histogram into this one.
+         * @param other The histogram to be merged.
+         * @return The merged histogram.
+         */
+        inline latency_histogram& merge(const latency_histogram& other) noexcept
+        {
+            m_counts = operation::zipwith(m_counts, other.m_counts, std::plus<uint64_t>());
+            return *this;
+        }
+
+        /**
+         * Informs the total number of recorded values.
+         * @return The number of recorded values.
+         */
+        inline uint64_t total() const noexcept
+        {
+            return prefix().back();
+        }
+
+        /**
+         * Estimates a percentile of the recorded values, as the highest value of the
+         * bucket holding the percentile's rank.
+         * @param p The percentile to be estimated, between zero and a hundred.
+         * @return The estimated percentile, or zero if the histogram is empty.
+         */
+        inline uint64_t percentile(double p) const noexcept
+        {
+            const auto sums = prefix();
+            const uint64_t total = sums.back();
+            if (total == 0) return 0;
+
+            const double rank = std::ceil(std::min(std::max(p, 0.0), 100.0) / 100.0 * (double) total);
+            const uint64_t target = std::max<uint64_t>(1, std::min(total, (uint64_t) rank));
+
+            size_t index = 0;
+            while (sums[index] < target) ++index;
+            return upper(index);
+        }
+
+        /**
+         * Clears all recorded values.
+         */
+        inline void reset() noexcept
+        {
+            m_counts = counts_t();
+        }
+
+        /**
+         * Exposes the histogram's bucket counts.
+         * @return The bucket counts.
+         */
+        SUPERTUPLE_CONSTEXPR const counts_t& counts() const noexcept
+        {
+            return m_counts;
+        }
+
+    private:
+        /**
+         * Computes the cumulative counts of the histogram's buckets. The counts are
+         * left-scanned in fixed-width chunks, carrying the running total from one
+         * chunk to the next, which keeps the scan's recursion shallow.
+         * @return The number of values recorded up to and including each bucket.
+         */
+        inline std::array<uint64_t, count> prefix() const noexcept
+        {
+            std::array<uint64_t, count> result;
+            uint64_t *out = result.data();
+            uint64_t base = 0;
+
+            operation::foreach(
+                operation::chunk<detail::histogram_chunk>(m_counts)
+              , [&](const auto& part) {
+                    constexpr size_t n = std::decay_t<decltype(part)>::count;
+                    const auto sums = operation::scanl(part, std::plus<uint64_t>(), base);
+                    spill(sums, out, std::make_index_sequence<n>());
+                    if constexpr (n > 0) base = out[n - 1];
+                    out += n;
+                });
+
+            return result;
+        }
+
+        /**
+         * Copies the cumulative counts of a chunk's left-scan, without its base.
+         * @tparam S The left-scan's tuple type.
+         * @tparam I The chunk's element indeces.
+         * @param sums The left-scan over the chunk's bucket counts.
+         * @param out The buffer to copy the cumulative counts into.
+         */
+        template <typename S, size_t ...I>
+        inline static void spill(const S& sums, uint64_t *out, std::index_sequence<I...>) noexcept
+        {
+            ((out[I] = (uint64_t) operation::get<I + 1>(sums)), ...);
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
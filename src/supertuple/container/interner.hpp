@@ -0,0 +1,450 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The hash-consing tuple interner implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/container/soa.hpp>
+#include <supertuple/operation/get.hpp>
+#include <supertuple/operation/hash.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+template <typename T>
+class interner;
+
+template <typename T>
+class concurrent_interner;
+
+namespace detail
+{
+    /**
+     * An append-only arena of characters. Characters are copied into large blocks
+     * which are never moved nor freed while the arena lives, so views into them
+     * remain valid for as long as the arena does.
+     * @since 1.0
+     */
+    class arena_t
+    {
+        private:
+            static constexpr size_t block = 65536;
+
+            std::vector<std::unique_ptr<char[]>> m_blocks;
+            size_t m_used = 0;
+            size_t m_size = 0;
+
+        public:
+            inline arena_t() = default;
+            inline arena_t(const arena_t&) = delete;
+            inline arena_t(arena_t&&) noexcept = default;
+
+            inline arena_t& operator=(const arena_t&) = delete;
+            inline arena_t& operator=(arena_t&&) noexcept = default;
+
+            /**
+             * Copies a string into the arena.
+             * @param text The string to be copied.
+             * @return The view of the string's copy.
+             */
+            inline std::string_view store(std::string_view text)
+            {
+                if (text.empty()) return std::string_view();
+
+                if (text.size() > m_size - m_used) {
+                    m_size = std::max(block, text.size());
+                    m_blocks.emplace_back(new char[m_size]);
+                    m_used = 0;
+                }
+
+                char *out = m_blocks.back().get() + m_used;
+                std::memcpy(out, text.data(), text.size());
+                m_used += text.size();
+                return std::string_view(out, text.size());
+            }
+    };
+
+    /**
+     * Converts a looked up element into the type stored by an interner. String views
+     * are copied into the interner's arena, so interned values never refer to the
+     * memory of the tuples they were interned from.
+     * @tparam T The stored element type.
+     * @tparam U The looked up element type.
+     * @param arena The interner's character arena.
+     * @param value The element to be stored.
+     * @return The element to be stored.
+     */
+    template <typename T, typename U>
+    inline T intern(arena_t& arena, const U& value)
+    {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            return arena.store(std::string_view(value));
+        } else {
+            return T(value);
+        }
+    }
+}
+
+/**
+ * A hash-consing interner of tuples. Each distinct tuple is stored exactly once, in
+ * structure-of-arrays storage, and is identified by a stable 32-bit id, so that a
+ * repeated value costs only its id. Strings referred to by views are copied into an
+ * arena owned by the interner. Tuples are found by an open-addressing table of ids,
+ * tagged with their hashes' high bits, so that lookups seldom touch the values, and
+ * can be looked up by any tuple which hashes and compares equally, such as one
+ * created by `tie`, without building an owning tuple.
+ * @tparam T The interned tuple's element types.
+ * @since 1.0
+ */
+template <typename ...T>
+class interner<tuple_t<T...>>
+{
+    public:
+        typedef tuple_t<T...> value_t;
+        typedef uint32_t id_t;
+        typedef typename soa_t<T...>::const_reference_t const_reference_t;
+
+    private:
+        /**
+         * A table slot, which is empty while its id is zero. Ids are stored shifted
+         * by one, and tagged with the high bits of their values' hashes.
+         * @since 1.0
+         */
+        struct slot_t
+        {
+            uint32_t id = 0;
+            uint32_t tag = 0;
+        };
+
+    private:
+        soa_t<T...> m_values;
+        std::vector<slot_t> m_slots;
+        detail::arena_t m_arena;
+
+    public:
+        inline interner(const interner&) = delete;
+        inline interner(interner&&) noexcept = default;
+
+        /**
+         * Creates an empty interner.
+         * @param capacity The number of distinct tuples to reserve space for.
+         */
+        inline explicit interner(size_t capacity = 16)
+        {
+            size_t slots = 16;
+            while (slots * 3 < capacity * 4) slots <<= 1;
+            m_slots.resize(slots);
+            m_values.reserve(capacity);
+        }
+
+        inline interner& operator=(const interner&) = delete;
+        inline interner& operator=(interner&&) noexcept = default;
+
+        /**
+         * Interns a tuple, storing it if it has not been seen before.
+         * @tparam U The interned tuple's type, possibly a tuple of references.
+         * @param key The tuple to be interned.
+         * @return The tuple's id.
+         */
+        template <typename U>
+        inline id_t intern(const U& key)
+        {
+            return insert(key, operation::hash(key));
+        }
+
+        /**
+         * Searches for the id of an already interned tuple.
+         * @tparam U The searched tuple's type, possibly a tuple of references.
+         * @param key The tuple to be searched.
+         * @return The tuple's id, if it has been interned.
+         */
+        template <typename U>
+        inline std::optional<id_t> find(const U& key) const
+        {
+            return lookup(key, operation::hash(key));
+        }
+
+        /**
+         * Retrieves an interned tuple by its id.
+         * @param id The interned tuple's id.
+         * @return The tuple of references to the interned tuple's elements.
+         */
+        inline const_reference_t operator[](id_t id) const noexcept
+        {
+            return m_values[id];
+        }
+
+        /**
+         * Exposes a column of the interned tuples, indexed by their ids.
+         * @tparam I The column index.
+         * @return The column of the interned tuples' elements.
+         */
+        template <size_t I>
+        inline decltype(auto) column() const noexcept
+        {
+            return m_values.template column<I>();
+        }
+
+        /**
+         * Informs the number of distinct tuples interned.
+         * @return The number of interned tuples.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_values.size();
+        }
+
+    private:
+        /**
+         * Searches for a tuple with a precomputed hash.
+         * @tparam U The searched tuple's type.
+         * @param key The tuple to be searched.
+         * @param hash The tuple's hash.
+         * @return The tuple's id, if it has been interned.
+         */
+        template <typename U>
+        inline std::optional<id_t> lookup(const U& key, uint64_t hash) const
+        {
+            const size_t mask = m_slots.size() - 1;
+            const uint32_t tag = (uint32_t) (hash >> 32);
+
+            for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+                const slot_t slot = m_slots[i];
+                if (slot.id == 0) return std::nullopt;
+                if (slot.tag == tag && m_values[slot.id - 1] == key) return slot.id - 1;
+            }
+        }
+
+        /**
+         * Interns a tuple with a precomputed hash.
+         * @tparam U The interned tuple's type.
+         * @param key The tuple to be interned.
+         * @param hash The tuple's hash.
+         * @return The tuple's id.
+         */
+        template <typename U>
+        inline id_t insert(const U& key, uint64_t hash)
+        {
+            const size_t mask = m_slots.size() - 1;
+            const uint32_t tag = (uint32_t) (hash >> 32);
+            size_t i = hash & mask;
+
+            for (; m_slots[i].id != 0; i = (i + 1) & mask)
+                if (m_slots[i].tag == tag && m_values[m_slots[i].id - 1] == key)
+                    return m_slots[i].id - 1;
+
+            if (m_values.size() >= (size_t) std::numeric_limits<id_t>::max())
+                throw std::length_error("too many distinct tuples to intern");
+
+            const id_t id = (id_t) m_values.size();
+            store(key, std::index_sequence_for<T...>());
+            m_slots[i] = slot_t {id + 1, tag};
+
+            if ((m_values.size() * 4) > (m_slots.size() * 3))
+                grow();
+
+            return id;
+        }
+
+        /**
+         * Stores a new distinct tuple.
+         * @tparam U The stored tuple's type.
+         * @tparam I The tuple's sequence indeces.
+         * @param key The tuple to be stored.
+         */
+        template <typename U, size_t ...I>
+        inline void store(const U& key, std::index_sequence<I...>)
+        {
+            m_values.push_back(value_t(detail::intern<T>(m_arena, operation::get<I>(key))...));
+        }
+
+        /**
+         * Doubles the number of table slots, rehashing all interned tuples.
+         */
+        inline void grow()
+        {
+            std::vector<slot_t> slots (m_slots.size() * 2);
+            const size_t mask = slots.size() - 1;
+
+            for (id_t id = 0; id < (id_t) m_values.size(); ++id) {
+                const uint64_t hash = operation::hash(m_values[id]);
+                size_t i = hash & mask;
+                while (slots[i].id != 0) i = (i + 1) & mask;
+                slots[i] = slot_t {id + 1, (uint32_t) (hash >> 32)};
+            }
+
+            m_slots.swap(slots);
+        }
+
+    friend class concurrent_interner<tuple_t<T...>>;
+};
+
+/**
+ * A hash-consing interner of tuples shared by many threads. The interner is split
+ * into shards, chosen by the high bits of the tuples' hashes, each one an interner
+ * with its own reader-writer lock, so that threads interning already seen tuples
+ * only share their locks and threads interning new ones seldom contend. The shard
+ * of a tuple is kept in the low bits of its id, so ids stay within 32 bits but are
+ * not dense. Interned tuples are copied out, as the shards' storage may be moved
+ * while it grows, but strings referred to by views remain in the shards' arenas.
+ * @tparam T The interned tuple's element types.
+ * @since 1.0
+ */
+template <typename ...T>
+class concurrent_interner<tuple_t<T...>>
+{
+    public:
+        typedef tuple_t<T...> value_t;
+        typedef uint32_t id_t;
+
+    private:
+        /**
+         * A shard of the interner, aligned to its own cache line so that the locks of
+         * different shards never share a line.
+         * @since 1.0
+         */
+        struct alignas(64) shard_t
+        {
+            mutable std::shared_mutex lock;
+            interner<value_t> values;
+        };
+
+    private:
+        size_t m_bits;
+        std::unique_ptr<shard_t[]> m_shards;
+
+    public:
+        inline concurrent_interner(const concurrent_interner&) = delete;
+        inline concurrent_interner(concurrent_interner&&) = delete;
+
+        /**
+         * Creates an empty interner with the given number of shards.
+         * @param shards The minimum number of shards, rounded up to a power of two.
+         */
+        inline explicit concurrent_interner(size_t shards = 64)
+          : m_bits (0)
+        {
+            while ((size_t(1) << m_bits) < shards && m_bits < 16) ++m_bits;
+            m_shards.reset(new shard_t[size_t(1) << m_bits]);
+        }
+
+        inline concurrent_interner& operator=(const concurrent_interner&) = delete;
+        inline concurrent_interner& operator=(concurrent_interner&&) = delete;
+
+        /**
+         * Interns a tuple, storing it if it has not been seen before. The tuple is
+         * first searched under a shared lock, which is only upgraded if it is new.
+         * @tparam U The interned tuple's type, possibly a tuple of references.
+         * @param key The tuple to be interned.
+         * @return The tuple's id.
+         */
+        template <typename U>
+        inline id_t intern(const U& key)
+        {
+            const uint64_t hash = operation::hash(key);
+            const size_t s = shard_of(hash);
+            shard_t& shard = m_shards[s];
+
+            {
+                std::shared_lock guard (shard.lock);
+                if (auto id = shard.values.lookup(key, hash)) return compose(*id, s);
+            }
+
+            std::unique_lock guard (shard.lock);
+            if (auto id = shard.values.lookup(key, hash)) return compose(*id, s);
+
+            if ((shard.values.size() >> (32 - m_bits)) > 0)
+                throw std::length_error("too many distinct tuples to intern");
+
+            return compose(shard.values.insert(key, hash), s);
+        }
+
+        /**
+         * Searches for the id of an already interned tuple.
+         * @tparam U The searched tuple's type, possibly a tuple of references.
+         * @param key The tuple to be searched.
+         * @return The tuple's id, if it has been interned.
+         */
+        template <typename U>
+        inline std::optional<id_t> find(const U& key) const
+        {
+            const uint64_t hash = operation::hash(key);
+            const size_t s = shard_of(hash);
+
+            std::shared_lock guard (m_shards[s].lock);
+            if (auto id = m_shards[s].values.lookup(key, hash)) return compose(*id, s);
+            return std::nullopt;
+        }
+
+        /**
+         * Retrieves a copy of an interned tuple by its id.
+         * @param id The interned tuple's id.
+         * @return The interned tuple.
+         */
+        inline value_t operator[](id_t id) const
+        {
+            const shard_t& shard = m_shards[id & ((id_t(1) << m_bits) - 1)];
+            std::shared_lock guard (shard.lock);
+            return shard.values.m_values.gather(id >> m_bits);
+        }
+
+        /**
+         * Informs the number of distinct tuples interned.
+         * @return The number of interned tuples.
+         */
+        inline size_t size() const
+        {
+            size_t total = 0;
+
+            for (size_t s = 0; s < (size_t(1) << m_bits); ++s) {
+                std::shared_lock guard (m_shards[s].lock);
+                total += m_shards[s].values.size();
+            }
+
+            return total;
+        }
+
+    private:
+        /**
+         * Retrieves the shard a hash belongs to, by the hash's high bits, as the low
+         * bits pick the slots of the shard's table.
+         * @param hash The tuple's hash value.
+         * @return The shard's index.
+         */
+        inline size_t shard_of(uint64_t hash) const noexcept
+        {
+            return m_bits > 0 ? (size_t) (hash >> (64 - m_bits)) : 0;
+        }
+
+        /**
+         * Composes an id from a shard-local id and its shard.
+         * @param id The shard-local id.
+         * @param shard The shard's index.
+         * @return The composed id.
+         */
+        inline id_t compose(id_t id, size_t shard) const noexcept
+        {
+            return (id_t) ((id << m_bits) | shard);
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
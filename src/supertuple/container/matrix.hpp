@@ -0,0 +1,460 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The fixed-size matrix type and its linear-algebra kernels.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/find.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Picks the alignment of a block of elements, so that blocks whose sizes are
+     * multiples of a vector register can be moved with aligned vector instructions.
+     * @tparam T The block's elements' type.
+     * @tparam N The number of elements in the block.
+     * @return The block's alignment.
+     */
+    template <typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR size_t alignment() noexcept
+    {
+        size_t result = simd::width;
+        while (result > alignof(T) && (sizeof(T) * N) % result != 0) result /= 2;
+        return result > alignof(T) ? result : alignof(T);
+    }
+}
+
+/**
+ * A fixed-size matrix, whose elements are stored in row-major order in a flat n-tuple.
+ * All of its kernels are unrolled at compile-time through index sequences, so that
+ * small matrices, such as 3x3 and 4x4 transforms, live entirely in registers.
+ * @tparam T The matrix's elements' type.
+ * @tparam R The matrix's number of rows.
+ * @tparam C The matrix's number of columns.
+ * @since 1.0
+ */
+template <typename T, size_t R, size_t C>
+class alignas(detail::alignment<T, R * C>()) matrix_t : public ntuple_t<T, R * C>
+{
+    static_assert(std::is_arithmetic_v<T>, "matrices must have arithmetic elements");
+    static_assert(R > 0 && C > 0, "matrices must have at least one element");
+
+    private:
+        typedef ntuple_t<T, R * C> underlying_t;
+
+    public:
+        typedef T element_t;
+
+        static constexpr size_t rows = R;
+        static constexpr size_t cols = C;
+
+    public:
+        SUPERTUPLE_CONSTEXPR matrix_t() noexcept = default;
+        SUPERTUPLE_CONSTEXPR matrix_t(const matrix_t&) = default;
+        SUPERTUPLE_CONSTEXPR matrix_t(matrix_t&&) = default;
+
+        using underlying_t::underlying_t;
+
+        /**
+         * Creates a matrix from the elements of an n-tuple in row-major order.
+         * @param t The n-tuple to create the matrix from.
+         */
+        SUPERTUPLE_CONSTEXPR matrix_t(const underlying_t& t)
+          : underlying_t (t)
+        {}
+
+        SUPERTUPLE_INLINE matrix_t& operator=(const matrix_t&) = default;
+        SUPERTUPLE_INLINE matrix_t& operator=(matrix_t&&) = default;
+
+        /**
+         * Retrieves an element of the matrix by its compile-time position.
+         * @tparam I The element's row.
+         * @tparam J The element's column.
+         * @return The element's reference.
+         */
+        template <size_t I, size_t J>
+        SUPERTUPLE_CONSTEXPR T& at() noexcept
+        {
+            static_assert(I < R && J < C, "matrix element position is out of bounds");
+            return operation::get<I * C + J>(*this);
+        }
+
+        /**
+         * Retrieves a const-qualified element of the matrix by its compile-time position.
+         * @tparam I The element's row.
+         * @tparam J The element's column.
+         * @return The element's const-qualified reference.
+         */
+        template <size_t I, size_t J>
+        SUPERTUPLE_CONSTEXPR const T& at() const noexcept
+        {
+            static_assert(I < R && J < C, "matrix element position is out of bounds");
+            return operation::get<I * C + J>(*this);
+        }
+
+        /**
+         * Retrieves an element of the matrix by its run-time position. This is meant
+         * for convenience only, as kernels are better off with compile-time positions.
+         * @param i The element's row.
+         * @param j The element's column.
+         * @return The element's reference.
+         */
+        SUPERTUPLE_INLINE T& operator()(size_t i, size_t j) noexcept
+        {
+            return *element(*this, i * C + j, std::make_index_sequence<R * C>());
+        }
+
+        /**
+         * Retrieves a const-qualified element of the matrix by its run-time position.
+         * @param i The element's row.
+         * @param j The element's column.
+         * @return The element's const-qualified reference.
+         */
+        SUPERTUPLE_INLINE const T& operator()(size_t i, size_t j) const noexcept
+        {
+            return *element(*this, i * C + j, std::make_index_sequence<R * C>());
+        }
+
+        /**
+         * Creates an identity matrix.
+         * @return The new identity matrix.
+         */
+        SUPERTUPLE_CONSTEXPR static matrix_t identity() noexcept
+        {
+            static_assert(R == C, "only square matrices have an identity");
+            return identity(std::make_index_sequence<R * C>());
+        }
+
+    private:
+        /**
+         * Finds an element of the matrix by its run-time offset.
+         * @tparam M The matrix type, possibly const-qualified.
+         * @tparam I The matrix's sequence indeces.
+         * @param m The matrix to find the element in.
+         * @param k The element's offset.
+         * @return The pointer to the element.
+         */
+        template <typename M, size_t ...I>
+        SUPERTUPLE_INLINE static auto element(M& m, size_t k, std::index_sequence<I...>) noexcept
+        {
+            decltype(&operation::get<0>(m)) result = nullptr;
+            ((k == I ? (void) (result = &operation::get<I>(m)) : (void) 0), ...);
+            return result;
+        }
+
+        /**
+         * Creates an identity matrix by unrolling its elements.
+         * @tparam I The matrix's sequence indeces.
+         * @return The new identity matrix.
+         */
+        template <size_t ...I>
+        SUPERTUPLE_CONSTEXPR static matrix_t identity(std::index_sequence<I...>) noexcept
+        {
+            return matrix_t(T(I / C == I % C)...);
+        }
+};
+
+namespace detail
+{
+    /**
+     * Computes an element of a matrix product by unrolling its dot product.
+     * @tparam I The element's row.
+     * @tparam J The element's column.
+     * @tparam K The inner dimension's sequence indeces.
+     * @tparam N The number of columns in the right-hand matrix.
+     * @tparam A The left-hand matrix type.
+     * @tparam B The right-hand matrix type.
+     * @param a The left-hand matrix.
+     * @param b The right-hand matrix.
+     * @return The element of the product.
+     */
+    template <size_t I, size_t J, size_t N, typename A, typename B, size_t ...K>
+    SUPERTUPLE_CONSTEXPR auto dot(const A& a, const B& b, std::index_sequence<K...>) noexcept
+    {
+        constexpr size_t M = sizeof...(K);
+        return ((operation::get<I * M + K>(a) * operation::get<K * N + J>(b)) + ...);
+    }
+
+    /**
+     * Multiplies two matrices by unrolling all elements of their product.
+     * @tparam R The left-hand matrix's number of rows.
+     * @tparam N The right-hand matrix's number of columns.
+     * @tparam A The left-hand matrix type.
+     * @tparam B The right-hand matrix type.
+     * @tparam O The product's sequence indeces.
+     * @param a The left-hand matrix.
+     * @param b The right-hand matrix.
+     * @return The matrix product.
+     */
+    template <size_t R, size_t N, typename A, typename B, size_t ...O>
+    SUPERTUPLE_CONSTEXPR auto matmul(const A& a, const B& b, std::index_sequence<O...>) noexcept
+    {
+        using element_t = decltype(operation::get<0>(a) * operation::get<0>(b));
+        using inner_t = std::make_index_sequence<A::cols>;
+        return matrix_t<element_t, R, N>(detail::dot<O / N, O % N, N>(a, b, inner_t())...);
+    }
+
+    /**
+     * Multiplies a matrix by a column vector by unrolling all dot products.
+     * @tparam M The matrix type.
+     * @tparam V The vector type.
+     * @tparam O The product's sequence indeces.
+     * @param m The matrix to be multiplied.
+     * @param v The vector to be multiplied.
+     * @return The product vector.
+     */
+    template <typename M, typename V, size_t ...O>
+    SUPERTUPLE_CONSTEXPR auto matvec(const M& m, const V& v, std::index_sequence<O...>) noexcept
+    {
+        using element_t = decltype(operation::get<0>(m) * operation::get<0>(v));
+        using inner_t = std::make_index_sequence<M::cols>;
+        return ntuple_t<element_t, M::rows>(detail::dot<O, 0, 1>(m, v, inner_t())...);
+    }
+
+    /**
+     * Transposes a matrix by unrolling all of its elements.
+     * @tparam T The matrix's elements' type.
+     * @tparam R The matrix's number of rows.
+     * @tparam C The matrix's number of columns.
+     * @tparam O The transposed matrix's sequence indeces.
+     * @param m The matrix to be transposed.
+     * @return The transposed matrix.
+     */
+    template <typename T, size_t R, size_t C, size_t ...O>
+    SUPERTUPLE_CONSTEXPR auto transpose(const matrix_t<T, R, C>& m, std::index_sequence<O...>) noexcept
+    {
+        return matrix_t<T, C, R>(operation::get<(O % R) * C + O / R>(m)...);
+    }
+
+    /**
+     * Reduces a square matrix in-place by Gauss-Jordan elimination with partial pivoting.
+     * The loops have compile-time bounds only, so that compilers may fully unroll them
+     * for small sizes. When an inverse is requested, it is built alongside the matrix.
+     * @tparam N The matrix's size.
+     * @tparam T The matrix's elements' type.
+     * @param a The matrix's elements in row-major order.
+     * @param inverse The identity matrix's elements, or null if not requested.
+     * @return The matrix's determinant.
+     */
+    template <size_t N, typename T>
+    inline T eliminate(std::array<T, N * N>& a, std::array<T, N * N> *inverse) noexcept
+    {
+        T det = T(1);
+
+        for (size_t k = 0; k < N; ++k) {
+            size_t pivot = k;
+
+            for (size_t i = k + 1; i < N; ++i)
+                if (std::abs(a[i * N + k]) > std::abs(a[pivot * N + k])) pivot = i;
+
+            if (a[pivot * N + k] == T(0))
+                return T(0);
+
+            if (pivot != k) {
+                det = -det;
+                for (size_t j = 0; j < N; ++j) std::swap(a[k * N + j], a[pivot * N + j]);
+                if (inverse) for (size_t j = 0; j < N; ++j) std::swap((*inverse)[k * N + j], (*inverse)[pivot * N + j]);
+            }
+
+            const T diagonal = a[k * N + k];
+            det *= diagonal;
+
+            if (inverse) {
+                for (size_t j = k; j < N; ++j) a[k * N + j] /= diagonal;
+                for (size_t j = 0; j < N; ++j) (*inverse)[k * N + j] /= diagonal;
+            }
+
+            for (size_t i = (inverse ? 0 : k + 1); i < N; ++i) {
+                if (i == k) continue;
+                const T factor = a[i * N + k] / a[k * N + k];
+                for (size_t j = k; j < N; ++j) a[i * N + j] -= factor * a[k * N + j];
+                if (inverse) for (size_t j = 0; j < N; ++j) (*inverse)[i * N + j] -= factor * (*inverse)[k * N + j];
+            }
+        }
+
+        return det;
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Multiplies two matrices.
+     * @tparam T The left-hand matrix's elements' type.
+     * @tparam U The right-hand matrix's elements' type.
+     * @tparam R The left-hand matrix's number of rows.
+     * @tparam C The inner dimension of the product.
+     * @tparam N The right-hand matrix's number of columns.
+     * @param a The left-hand matrix.
+     * @param b The right-hand matrix.
+     * @return The matrix product.
+     */
+    template <typename T, typename U, size_t R, size_t C, size_t N>
+    SUPERTUPLE_CONSTEXPR auto matmul(const matrix_t<T, R, C>& a, const matrix_t<U, C, N>& b) noexcept
+    {
+        return detail::matmul<R, N>(a, b, std::make_index_sequence<R * N>());
+    }
+
+    /**
+     * Multiplies a matrix by a column vector.
+     * @tparam T The matrix's elements' type.
+     * @tparam U The vector's elements' type.
+     * @tparam R The matrix's number of rows.
+     * @tparam C The matrix's number of columns.
+     * @param m The matrix to be multiplied.
+     * @param v The vector to be multiplied.
+     * @return The product vector.
+     */
+    template <typename T, typename U, size_t R, size_t C>
+    SUPERTUPLE_CONSTEXPR auto matvec(const matrix_t<T, R, C>& m, const ntuple_t<U, C>& v) noexcept
+    {
+        return detail::matvec(m, v, std::make_index_sequence<R>());
+    }
+
+    /**
+     * Transposes a matrix.
+     * @tparam T The matrix's elements' type.
+     * @tparam R The matrix's number of rows.
+     * @tparam C The matrix's number of columns.
+     * @param m The matrix to be transposed.
+     * @return The transposed matrix.
+     */
+    template <typename T, size_t R, size_t C>
+    SUPERTUPLE_CONSTEXPR auto transpose(const matrix_t<T, R, C>& m) noexcept
+    {
+        return detail::transpose(m, std::make_index_sequence<R * C>());
+    }
+
+    /**
+     * Computes the determinant of a square matrix. Sizes up to 3 are expanded into
+     * closed formulas, while larger ones are eliminated with partial pivoting, in
+     * double precision for integral matrices.
+     * @tparam T The matrix's elements' type.
+     * @tparam N The matrix's size.
+     * @param m The matrix to compute the determinant of.
+     * @return The matrix's determinant.
+     */
+    template <typename T, size_t N>
+    inline T determinant(const matrix_t<T, N, N>& m) noexcept
+    {
+        if constexpr (N == 1) {
+            return m.template at<0, 0>();
+        } else if constexpr (N == 2) {
+            return m.template at<0, 0>() * m.template at<1, 1>()
+                 - m.template at<0, 1>() * m.template at<1, 0>();
+        } else if constexpr (N == 3) {
+            return m.template at<0, 0>() * (m.template at<1, 1>() * m.template at<2, 2>() - m.template at<1, 2>() * m.template at<2, 1>())
+                 - m.template at<0, 1>() * (m.template at<1, 0>() * m.template at<2, 2>() - m.template at<1, 2>() * m.template at<2, 0>())
+                 + m.template at<0, 2>() * (m.template at<1, 0>() * m.template at<2, 1>() - m.template at<1, 1>() * m.template at<2, 0>());
+        } else {
+            using real_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+            const auto source = detail::contiguous(m, std::make_index_sequence<N * N>());
+
+            std::array<real_t, N * N> a;
+            for (size_t k = 0; k < N * N; ++k) a[k] = (real_t) source[k];
+
+            const real_t det = detail::eliminate<N, real_t>(a, nullptr);
+            if constexpr (std::is_floating_point_v<T>) return det;
+            else return (T) std::llround(det);
+        }
+    }
+
+    /**
+     * Computes the inverse of a square floating-point matrix. Sizes up to 3 use the
+     * adjugate matrix, while larger ones use Gauss-Jordan elimination. The inverse
+     * of a singular matrix has non-finite elements.
+     * @tparam T The matrix's elements' type.
+     * @tparam N The matrix's size.
+     * @param m The matrix to be inverted.
+     * @return The inverse matrix.
+     */
+    template <typename T, size_t N>
+    inline matrix_t<T, N, N> inverse(const matrix_t<T, N, N>& m) noexcept
+    {
+        static_assert(std::is_floating_point_v<T>, "only floating-point matrices can be inverted");
+
+        if constexpr (N <= 3) {
+            const T r = T(1) / operation::determinant(m);
+            auto e = [&m](auto i, auto j) { return m.template at<decltype(i)::value, decltype(j)::value>(); };
+            using _0 = std::integral_constant<size_t, 0>;
+            using _1 = std::integral_constant<size_t, 1>;
+            using _2 = std::integral_constant<size_t, 2>;
+
+            if constexpr (N == 1) {
+                return matrix_t<T, 1, 1>(r);
+            } else if constexpr (N == 2) {
+                return matrix_t<T, 2, 2>(
+                    e(_1(), _1()) * r, -e(_0(), _1()) * r
+                  , -e(_1(), _0()) * r, e(_0(), _0()) * r);
+            } else {
+                auto cofactor = [&](auto a, auto b, auto c, auto d) {
+                    return e(a, b) * e(c, d) - e(a, d) * e(c, b);
+                };
+
+                return matrix_t<T, 3, 3>(
+                    cofactor(_1(), _1(), _2(), _2()) * r, cofactor(_0(), _2(), _2(), _1()) * r, cofactor(_0(), _1(), _1(), _2()) * r
+                  , cofactor(_1(), _2(), _2(), _0()) * r, cofactor(_0(), _0(), _2(), _2()) * r, cofactor(_0(), _2(), _1(), _0()) * r
+                  , cofactor(_1(), _0(), _2(), _1()) * r, cofactor(_0(), _1(), _2(), _0()) * r, cofactor(_0(), _0(), _1(), _1()) * r);
+            }
+        } else {
+            auto a = detail::contiguous(m, std::make_index_sequence<N * N>());
+            auto result = detail::contiguous(matrix_t<T, N, N>::identity(), std::make_index_sequence<N * N>());
+
+            if (detail::eliminate<N>(a, &result) == T(0))
+                result.fill(std::numeric_limits<T>::quiet_NaN());
+
+            return matrix_t<T, N, N>(result.data());
+        }
+    }
+}
+
+/**
+ * Multiplies two matrices.
+ * @tparam T The left-hand matrix's elements' type.
+ * @tparam U The right-hand matrix's elements' type.
+ * @tparam R The left-hand matrix's number of rows.
+ * @tparam C The inner dimension of the product.
+ * @tparam N The right-hand matrix's number of columns.
+ * @param a The left-hand matrix.
+ * @param b The right-hand matrix.
+ * @return The matrix product.
+ */
+template <typename T, typename U, size_t R, size_t C, size_t N>
+SUPERTUPLE_CONSTEXPR auto operator*(const matrix_t<T, R, C>& a, const matrix_t<U, C, N>& b) noexcept
+{
+    return operation::matmul(a, b);
+}
+
+/**
+ * Multiplies a matrix by a column vector.
+ * @tparam T The matrix's elements' type.
+ * @tparam U The vector's elements' type.
+ * @tparam R The matrix's number of rows.
+ * @tparam C The matrix's number of columns.
+ * @param m The matrix to be multiplied.
+ * @param v The vector to be multiplied.
+ * @return The product vector.
+ */
+template <typename T, typename U, size_t R, size_t C>
+SUPERTUPLE_CONSTEXPR auto operator*(const matrix_t<T, R, C>& m, const ntuple_t<U, C>& v) noexcept
+{
+    return operation::matvec(m, v);
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,274 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The read-copy-update published tuple snapshots implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The number of reader slots of a published tuple. Readers are spread over the
+     * slots by their threads, so that concurrent readers seldom share a cache line.
+     * @since 1.0
+     */
+    inline constexpr size_t rcu_slots = 64;
+
+    /**
+     * A slot of reader counters, one for each parity of the global epoch.
+     * @since 1.0
+     */
+    struct alignas(64) rcu_slot_t
+    {
+        std::atomic<size_t> readers[2] = {};
+    };
+
+    /**
+     * Informs the reader slot of the calling thread, which is computed only once.
+     * @return The calling thread's slot index.
+     */
+    inline size_t rcu_slot() noexcept
+    {
+        thread_local const size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id()) % rcu_slots;
+        return slot;
+    }
+}
+
+/**
+ * A tuple published to many readers by read-copy-update. Readers obtain a guarded
+ * pointer to an immutable snapshot, with a fixed number of atomic operations and
+ * never taking a lock, while writers build a modified copy of the current snapshot
+ * and publish it atomically. A replaced snapshot is retired and only reclaimed once
+ * the global epoch has advanced twice, which in turn only happens after all readers
+ * registered under the previous epochs have left. Readers are counted per epoch
+ * parity in slots spread over threads, so no reader ever has to be registered.
+ * @tparam T The tuple's element types.
+ * @since 1.0
+ */
+template <typename ...T>
+class rcu_tuple
+{
+    public:
+        typedef tuple_t<T...> value_t;
+
+        /**
+         * A reader's guarded snapshot. The snapshot is kept alive for as long as the
+         * guard exists, so guards should be short-lived.
+         * @since 1.0
+         */
+        class snapshot_t
+        {
+            private:
+                const value_t *m_value = nullptr;
+                std::atomic<size_t> *m_counter = nullptr;
+
+            public:
+                inline snapshot_t(const snapshot_t&) = delete;
+
+                /**
+                 * Moves a guarded snapshot into a new guard.
+                 * @param other The guard to be moved.
+                 */
+                inline snapshot_t(snapshot_t&& other) noexcept
+                  : m_value (std::exchange(other.m_value, nullptr))
+                  , m_counter (std::exchange(other.m_counter, nullptr))
+                {}
+
+                /**
+                 * Leaves the read-side critical section.
+                 */
+                inline ~snapshot_t()
+                {
+                    if (m_counter != nullptr) m_counter->fetch_sub(1, std::memory_order_release);
+                }
+
+                inline snapshot_t& operator=(const snapshot_t&) = delete;
+                inline snapshot_t& operator=(snapshot_t&&) = delete;
+
+                inline const value_t& operator*() const noexcept { return *m_value; }
+                inline const value_t *operator->() const noexcept { return m_value; }
+                inline const value_t *get() const noexcept { return m_value; }
+
+            private:
+                inline snapshot_t(const value_t *value, std::atomic<size_t> *counter) noexcept
+                  : m_value (value)
+                  , m_counter (counter)
+                {}
+
+            friend class rcu_tuple;
+        };
+
+    private:
+        std::atomic<const value_t*> m_current;
+        std::atomic<uint64_t> m_epoch {0};
+        detail::rcu_slot_t m_slots[detail::rcu_slots];
+
+        std::mutex m_writer;
+        std::vector<std::pair<uint64_t, std::unique_ptr<const value_t>>> m_retired;
+
+    public:
+        inline rcu_tuple(const rcu_tuple&) = delete;
+        inline rcu_tuple(rcu_tuple&&) = delete;
+
+        /**
+         * Publishes the initial snapshot.
+         * @param value The initial tuple.
+         */
+        inline explicit rcu_tuple(value_t value = value_t())
+          : m_current (new value_t(std::move(value)))
+        {}
+
+        /**
+         * Releases all snapshots. There must be no readers left.
+         */
+        inline ~rcu_tuple()
+        {
+            delete m_current.load(std::memory_order_relaxed);
+        }
+
+        inline rcu_tuple& operator=(const rcu_tuple&) = delete;
+        inline rcu_tuple& operator=(rcu_tuple&&) = delete;
+
+        /**
+         * Enters a read-side critical section and retrieves the current snapshot. The
+         * reader is counted under the current epoch's parity before loading the
+         * snapshot, so any writer which retires it afterwards will wait for the reader.
+         * @return The guarded current snapshot.
+         */
+        inline snapshot_t read() noexcept
+        {
+            const uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+            std::atomic<size_t> *counter = &m_slots[detail::rcu_slot()].readers[epoch & 1];
+
+            counter->fetch_add(1, std::memory_order_seq_cst);
+            return snapshot_t(m_current.load(std::memory_order_seq_cst), counter);
+        }
+
+        /**
+         * Publishes a new snapshot, replacing the whole tuple.
+         * @param value The new tuple to be published.
+         */
+        inline void publish(value_t value)
+        {
+            std::lock_guard guard (m_writer);
+            swap(std::make_unique<const value_t>(std::move(value)));
+        }
+
+        /**
+         * Publishes a new snapshot with a single element replaced.
+         * @tparam I The index of the element to be replaced.
+         * @tparam U The new element's type.
+         * @param element The new element's value.
+         */
+        template <size_t I, typename U>
+        inline void set(U&& element)
+        {
+            apply([&](value_t& value) { operation::get<I>(value) = std::forward<U>(element); });
+        }
+
+        /**
+         * Publishes a new snapshot built by editing a copy of the current one. Edits
+         * from concurrent writers are serialized, so no edit is ever lost.
+         * @tparam F The edit functor type.
+         * @param lambda The edit, invoked with a mutable copy of the current tuple.
+         */
+        template <typename F>
+        inline void apply(F&& lambda)
+        {
+            std::lock_guard guard (m_writer);
+            auto value = std::make_unique<value_t>(*m_current.load(std::memory_order_relaxed));
+            lambda(*value);
+            swap(std::move(value));
+        }
+
+        /**
+         * Tries to reclaim retired snapshots without blocking, advancing the epoch as
+         * far as the readers allow.
+         * @return The number of snapshots still waiting to be reclaimed.
+         */
+        inline size_t collect()
+        {
+            std::lock_guard guard (m_writer);
+            return reclaim();
+        }
+
+        /**
+         * Waits until all retired snapshots have been reclaimed. This must not be
+         * called from within a read-side critical section, as it would wait forever.
+         */
+        inline void synchronize()
+        {
+            while (collect() > 0)
+                std::this_thread::yield();
+        }
+
+    private:
+        /**
+         * Publishes a snapshot and retires the replaced one under the current epoch.
+         * The writer's lock must be held.
+         * @param value The snapshot to be published.
+         */
+        inline void swap(std::unique_ptr<const value_t> value)
+        {
+            const value_t *previous = m_current.exchange(value.release(), std::memory_order_seq_cst);
+            m_retired.emplace_back(m_epoch.load(std::memory_order_seq_cst), previous);
+            reclaim();
+        }
+
+        /**
+         * Advances the epoch while no readers are left under the previous epoch's
+         * parity, and reclaims all snapshots retired at least two epochs before. The
+         * writer's lock must be held.
+         * @return The number of snapshots still waiting to be reclaimed.
+         */
+        inline size_t reclaim()
+        {
+            for (size_t step = 0; step < 2 && !m_retired.empty(); ++step) {
+                const uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+                if (!drained((epoch + 1) & 1)) break;
+                m_epoch.store(epoch + 1, std::memory_order_seq_cst);
+            }
+
+            const uint64_t epoch = m_epoch.load(std::memory_order_relaxed);
+            size_t kept = 0;
+
+            for (auto& entry : m_retired)
+                if (entry.first + 2 > epoch) m_retired[kept++] = std::move(entry);
+
+            m_retired.resize(kept);
+            return kept;
+        }
+
+        /**
+         * Checks whether all readers registered under an epoch parity have left.
+         * @param parity The epoch parity to be checked.
+         * @return Are there no readers left under the parity?
+         */
+        inline bool drained(size_t parity) const noexcept
+        {
+            for (const auto& slot : m_slots)
+                if (slot.readers[parity].load(std::memory_order_seq_cst) != 0)
+                    return false;
+            return true;
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
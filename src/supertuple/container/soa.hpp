@@ -0,0 +1,213 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The structure-of-arrays container of tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+/**
+ * A sequence of tuples stored as structure-of-arrays, with one contiguous column
+ * for each of the tuple's elements. Kernels that only need a few of the elements
+ * may thus scan their columns without touching the others.
+ * @tparam T The tuple's element types.
+ * @since 1.0
+ */
+template <typename ...T>
+class soa_t
+{
+    static_assert(((!std::is_same_v<T, bool> && !std::is_reference_v<T>) && ...)
+      , "columns must be contiguous sequences of values");
+
+    public:
+        typedef tuple_t<T...> row_t;
+        typedef tuple_t<T&...> reference_t;
+        typedef tuple_t<const T&...> const_reference_t;
+
+        static constexpr size_t count = sizeof...(T);
+
+    private:
+        typedef std::make_index_sequence<count> indexer_t;
+
+    private:
+        tuple_t<std::vector<T>...> m_columns;
+
+    public:
+        inline soa_t() = default;
+        inline soa_t(const soa_t&) = default;
+        inline soa_t(soa_t&&) noexcept = default;
+
+        /**
+         * Creates a container with the given number of value-initialized rows.
+         * @param n The number of rows in the container.
+         */
+        inline explicit soa_t(size_t n)
+        {
+            resize(n);
+        }
+
+        inline soa_t& operator=(const soa_t&) = default;
+        inline soa_t& operator=(soa_t&&) noexcept = default;
+
+        /**
+         * Retrieves a row's elements' references.
+         * @param i The index of the row to be retrieved.
+         * @return The tuple of references to the row's elements.
+         */
+        inline reference_t operator[](size_t i) noexcept
+        {
+            return row<reference_t>(*this, i, indexer_t());
+        }
+
+        /**
+         * Retrieves a row's elements' const-qualified references.
+         * @param i The index of the row to be retrieved.
+         * @return The tuple of references to the row's elements.
+         */
+        inline const_reference_t operator[](size_t i) const noexcept
+        {
+            return row<const_reference_t>(*this, i, indexer_t());
+        }
+
+        /**
+         * Gathers copies of a row's elements into a tuple.
+         * @param i The index of the row to be gathered.
+         * @return The row's tuple.
+         */
+        inline row_t gather(size_t i) const
+        {
+            return row<row_t>(*this, i, indexer_t());
+        }
+
+        /**
+         * Retrieves one of the container's columns.
+         * @tparam I The index of the column to be retrieved.
+         * @return The column's contiguous sequence.
+         */
+        template <size_t I>
+        inline auto column() noexcept -> std::vector<tuple_element_t<row_t, I>>&
+        {
+            return operation::get<I>(m_columns);
+        }
+
+        /**
+         * Retrieves one of the container's const-qualified columns.
+         * @tparam I The index of the column to be retrieved.
+         * @return The column's contiguous sequence.
+         */
+        template <size_t I>
+        inline auto column() const noexcept -> const std::vector<tuple_element_t<row_t, I>>&
+        {
+            return operation::get<I>(m_columns);
+        }
+
+        /**
+         * Appends a row to the container, scattering its elements to the columns.
+         * @tparam U The appended tuple type.
+         * @param t The tuple to be appended.
+         */
+        template <typename U>
+        inline void push_back(const U& t)
+        {
+            static_assert(U::count == count, "appended rows must have all elements");
+            append(t, indexer_t());
+        }
+
+        /**
+         * Reserves memory for the given number of rows in all columns.
+         * @param n The number of rows to reserve memory for.
+         */
+        inline void reserve(size_t n)
+        {
+            each([n](auto& column) { column.reserve(n); }, indexer_t());
+        }
+
+        /**
+         * Resizes all columns to the given number of rows.
+         * @param n The new number of rows.
+         */
+        inline void resize(size_t n)
+        {
+            each([n](auto& column) { column.resize(n); }, indexer_t());
+        }
+
+        /**
+         * Removes all rows from the container.
+         */
+        inline void clear() noexcept
+        {
+            each([](auto& column) { column.clear(); }, indexer_t());
+        }
+
+        /**
+         * Informs the number of rows in the container.
+         * @return The container's number of rows.
+         */
+        inline size_t size() const noexcept
+        {
+            return operation::get<0>(m_columns).size();
+        }
+
+        /**
+         * Informs whether the container is empty.
+         * @return Is the container empty?
+         */
+        inline bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        /**
+         * Gathers a row's elements into a tuple of the requested type.
+         * @tparam R The tuple type to be gathered.
+         * @tparam S The container type, possibly const-qualified.
+         * @tparam I The tuple's sequence indeces.
+         * @param self The container to gather the row from.
+         * @param i The index of the row to be gathered.
+         * @return The gathered row.
+         */
+        template <typename R, typename S, size_t ...I>
+        inline static R row(S& self, size_t i, std::index_sequence<I...>)
+        {
+            return R(operation::get<I>(self.m_columns)[i]...);
+        }
+
+        /**
+         * Scatters a tuple's elements to the end of each column.
+         * @tparam U The appended tuple type.
+         * @tparam I The tuple's sequence indeces.
+         * @param t The tuple to be appended.
+         */
+        template <typename U, size_t ...I>
+        inline void append(const U& t, std::index_sequence<I...>)
+        {
+            (operation::get<I>(m_columns).push_back(operation::get<I>(t)), ...);
+        }
+
+        /**
+         * Applies a functor to each of the container's columns.
+         * @tparam F The functor type.
+         * @tparam I The tuple's sequence indeces.
+         * @param lambda The functor to be applied.
+         */
+        template <typename F, size_t ...I>
+        inline void each(const F& lambda, std::index_sequence<I...>)
+        {
+            (lambda(operation::get<I>(m_columns)), ...);
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
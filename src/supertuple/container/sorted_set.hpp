@@ -0,0 +1,299 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The read-only sorted sets with cache-friendly layouts implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The largest number of elements of a sorted set that are scanned linearly rather
+     * than searched through a tree. Below this size, comparing all elements with
+     * whole vectors at once is cheaper than following a chain of dependent loads.
+     * @since 1.0
+     */
+    inline constexpr size_t linear_limit = 64;
+
+    /**
+     * Reorders a sorted sequence into the Eytzinger layout, in which the elements
+     * are laid out as the breadth-first traversal of an implicit balanced search
+     * tree, whose root is at position 1 and the children of node k are at positions
+     * 2k and 2k + 1. The top levels of the tree thus share a few cache lines.
+     * @tparam T The sequence's elements' type.
+     * @param sorted The sorted sequence to be reordered.
+     * @param out The output sequence, with room for one element more than the input.
+     * @param n The number of elements in the sequence.
+     * @param i The index of the next sorted element to be placed.
+     * @param k The tree node to be filled.
+     */
+    template <typename T>
+    SUPERTUPLE_CONSTEXPR void eytzinger(const T *sorted, T *out, size_t n, size_t& i, size_t k = 1)
+    {
+        if (k <= n) {
+            detail::eytzinger(sorted, out, n, i, 2 * k);
+            out[k] = sorted[i++];
+            detail::eytzinger(sorted, out, n, i, 2 * k + 1);
+        }
+    }
+
+    /**
+     * Searches for the lower bound of a value in a sequence in Eytzinger layout. The
+     * descent has no branches but the loop's own, and the node four levels below is
+     * prefetched at each step, so that the memory latency of the deep levels, which
+     * are not likely to be in cache, is overlapped with the descent itself.
+     * @tparam T The sequence's elements' type.
+     * @param data The sequence, whose first element is at position 1.
+     * @param n The number of elements in the sequence.
+     * @param value The value to be searched.
+     * @return The value's lower bound, or null if all elements are lesser.
+     */
+    template <typename T>
+    inline const T *eytzinger_bound(const T *data, size_t n, const T& value) noexcept
+    {
+        constexpr size_t line = 64;
+        constexpr size_t stride = sizeof(T) < line ? line / sizeof(T) : 1;
+        size_t k = 1;
+
+        while (k <= n) {
+            simd::prefetch((const void*) ((uintptr_t) data + k * stride * sizeof(T)));
+            k = 2 * k + (data[k] < value);
+        }
+
+        // The descent goes right after every node lesser than the value, so the lower
+        // bound is the last node from which the descent went left. Such node is found
+        // by discarding the trailing right turns and the final left turn.
+      #if (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_GCC) || (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_CLANG)
+        k >>= __builtin_ctzll(~(unsigned long long) k) + 1;
+      #else
+        while (k & 1) k >>= 1;
+        k >>= 1;
+      #endif
+
+        return k ? data + k : nullptr;
+    }
+
+    /**
+     * Searches for the lower bound of a value in a small sorted sequence, by counting
+     * how many elements are lesser than the value with vector comparisons.
+     * @tparam T The sequence's elements' type.
+     * @param data The sorted sequence.
+     * @param n The number of elements in the sequence.
+     * @param value The value to be searched.
+     * @return The value's lower bound, or null if all elements are lesser.
+     */
+    template <typename T>
+    inline const T *linear_bound(const T *data, size_t n, const T& value) noexcept
+    {
+        const size_t rank = simd::rank(data, n, value);
+        return rank < n ? data + rank : nullptr;
+    }
+}
+
+/**
+ * A read-only sorted set built at compile-time from a n-tuple. Large sets are kept
+ * in Eytzinger layout and searched with a branchless prefetching descent, while
+ * small sets are kept sorted and searched with a vectorized linear scan. When declared
+ * as a constant expression, the whole set is stored in read-only data. Duplicated
+ * elements are kept, which does not affect any of the set's queries.
+ * @tparam T The set's elements' type.
+ * @tparam N The set's number of elements.
+ * @since 1.0
+ */
+template <typename T, size_t N>
+class static_sorted_set
+{
+    public:
+        typedef T element_t;
+
+    private:
+        static constexpr bool linear = N <= detail::linear_limit;
+
+    private:
+        alignas(64) std::array<T, N + 1> m_data {};
+
+    public:
+        SUPERTUPLE_CONSTEXPR static_sorted_set(const static_sorted_set&) = default;
+        SUPERTUPLE_CONSTEXPR static_sorted_set(static_sorted_set&&) = default;
+
+        /**
+         * Builds the set from the elements of a n-tuple.
+         * @param t The n-tuple with the set's elements.
+         */
+        SUPERTUPLE_CONSTEXPR static_sorted_set(const ntuple_t<T, N>& t)
+          : static_sorted_set (t, std::make_index_sequence<N>())
+        {}
+
+        SUPERTUPLE_CONSTEXPR static_sorted_set& operator=(const static_sorted_set&) = default;
+        SUPERTUPLE_CONSTEXPR static_sorted_set& operator=(static_sorted_set&&) = default;
+
+        /**
+         * Searches for the smallest element that is not lesser than a value.
+         * @param value The value to be searched.
+         * @return The value's lower bound, or null if all elements are lesser.
+         */
+        inline const T *lower_bound(const T& value) const noexcept
+        {
+            if constexpr (linear) {
+                return detail::linear_bound(m_data.data(), N, value);
+            } else {
+                return detail::eytzinger_bound(m_data.data(), N, value);
+            }
+        }
+
+        /**
+         * Checks whether a value is in the set.
+         * @param value The value to be searched.
+         * @return Is the value in the set?
+         */
+        inline bool contains(const T& value) const noexcept
+        {
+            const T *bound = lower_bound(value);
+            return bound && !(value < *bound);
+        }
+
+        /**
+         * Informs the number of elements in the set.
+         * @return The set's number of elements.
+         */
+        SUPERTUPLE_CONSTEXPR size_t size() const noexcept
+        {
+            return N;
+        }
+
+    private:
+        /**
+         * Sorts the n-tuple's elements and lays them out for searching.
+         * @tparam I The n-tuple's sequence indeces.
+         * @param t The n-tuple with the set's elements.
+         */
+        template <size_t ...I>
+        SUPERTUPLE_CONSTEXPR static_sorted_set(const ntuple_t<T, N>& t, std::index_sequence<I...>)
+        {
+            std::array<T, N + 1> sorted {operation::get<I>(t)...};
+
+            for (size_t i = 1; i < N; ++i)
+                for (size_t j = i; j > 0 && sorted[j] < sorted[j - 1]; --j) {
+                    const T x = sorted[j]; sorted[j] = sorted[j - 1]; sorted[j - 1] = x;
+                }
+
+            if constexpr (linear) {
+                m_data = sorted;
+            } else {
+                size_t i = 0;
+                detail::eytzinger(sorted.data(), m_data.data(), N, i);
+            }
+        }
+};
+
+/*
+ * Deduction guides for static sorted sets.
+ * @since 1.0
+ */
+template <typename T, size_t N> static_sorted_set(const ntuple_t<T, N>&) -> static_sorted_set<T, N>;
+
+/**
+ * A read-only sorted set built at run-time. The set is laid out and searched just
+ * as its compile-time counterpart, choosing the layout by the number of distinct
+ * elements it is built with.
+ * @tparam T The set's elements' type.
+ * @since 1.0
+ */
+template <typename T>
+class sorted_set
+{
+    public:
+        typedef T element_t;
+
+    private:
+        std::vector<T> m_data;
+        size_t m_size = 0;
+
+    public:
+        inline sorted_set() noexcept = default;
+        inline sorted_set(const sorted_set&) = default;
+        inline sorted_set(sorted_set&&) noexcept = default;
+
+        /**
+         * Builds the set from a range of elements.
+         * @tparam I The range's iterator type.
+         * @param first The range's first element.
+         * @param last The range's end.
+         */
+        template <typename I>
+        inline sorted_set(I first, I last)
+          : sorted_set (std::vector<T>(first, last))
+        {}
+
+        /**
+         * Builds the set from a list of elements.
+         * @param elements The set's elements, in any order.
+         */
+        inline explicit sorted_set(std::vector<T> elements)
+        {
+            std::sort(elements.begin(), elements.end());
+            elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+            m_size = elements.size();
+
+            if (m_size <= detail::linear_limit) {
+                m_data = std::move(elements);
+            } else {
+                size_t i = 0;
+                m_data.resize(m_size + 1);
+                detail::eytzinger(elements.data(), m_data.data(), m_size, i);
+            }
+        }
+
+        inline sorted_set& operator=(const sorted_set&) = default;
+        inline sorted_set& operator=(sorted_set&&) noexcept = default;
+
+        /**
+         * Searches for the smallest element that is not lesser than a value.
+         * @param value The value to be searched.
+         * @return The value's lower bound, or null if all elements are lesser.
+         */
+        inline const T *lower_bound(const T& value) const noexcept
+        {
+            return m_size <= detail::linear_limit
+                ? detail::linear_bound(m_data.data(), m_size, value)
+                : detail::eytzinger_bound(m_data.data(), m_size, value);
+        }
+
+        /**
+         * Checks whether a value is in the set.
+         * @param value The value to be searched.
+         * @return Is the value in the set?
+         */
+        inline bool contains(const T& value) const noexcept
+        {
+            const T *bound = lower_bound(value);
+            return bound && !(value < *bound);
+        }
+
+        /**
+         * Informs the number of elements in the set.
+         * @return The set's number of elements.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_size;
+        }
+};
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,350 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The hot and cold split tuple layout implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Informs the position of an index within a list of indeces.
+     * @tparam J The list of indeces.
+     * @param i The index to be found.
+     * @return The index's position, or the list's length if it is not listed.
+     */
+    template <size_t ...J>
+    SUPERTUPLE_CONSTEXPR size_t position(size_t i) noexcept
+    {
+        const size_t list[] = {J..., 0};
+        for (size_t k = 0; k < sizeof...(J); ++k)
+            if (list[k] == i) return k;
+        return sizeof...(J);
+    }
+
+    /**
+     * Lists, in increasing order, the indeces of a tuple which are not in a list.
+     * @tparam N The tuple's length.
+     * @tparam J The list of indeces to be left out.
+     * @since 1.0
+     */
+    template <size_t N, size_t ...J>
+    class complement_t
+    {
+        private:
+            static constexpr size_t count = N - sizeof...(J);
+
+            static constexpr std::array<size_t, count> values = []() {
+                std::array<size_t, count> result {};
+                for (size_t i = 0, k = 0; i < N; ++i)
+                    if (detail::position<J...>(i) == sizeof...(J)) result[k++] = i;
+                return result;
+            }();
+
+            template <size_t ...K>
+            static auto make(std::index_sequence<K...>) -> std::index_sequence<values[K]...>;
+
+        public:
+            typedef decltype(make(std::make_index_sequence<count>())) type;
+    };
+
+    template <typename H, typename C, typename ...T>
+    class split_t;
+
+    /**
+     * A tuple whose elements are split into a hot and a cold part. The hot elements
+     * are kept inline, while the cold ones are boxed into a single out-of-line
+     * allocation, which is only made when a cold element is first written to. Thus,
+     * a split tuple is as large as its hot part and a pointer, moves never touch the
+     * cold elements, and the hot part can be copied on its own. Elements are still
+     * reached by their logical indeces, wherever they are stored.
+     * @tparam H The indeces of the hot elements.
+     * @tparam C The indeces of the cold elements.
+     * @tparam T The tuple's element types.
+     * @since 1.0
+     */
+    template <size_t ...H, size_t ...C, typename ...T>
+    class split_t<std::index_sequence<H...>, std::index_sequence<C...>, T...>
+    {
+        static_assert(((H < sizeof...(T)) && ...), "hot indeces must be within the tuple");
+        static_assert(sizeof...(H) + sizeof...(C) == sizeof...(T), "hot indeces must not be repeated");
+
+        public:
+            typedef tuple_t<T...> value_t;
+            typedef tuple_t<tuple_element_t<value_t, H>...> hot_t;
+            typedef tuple_t<tuple_element_t<value_t, C>...> cold_t;
+
+            static constexpr size_t count = sizeof...(T);
+
+        private:
+            hot_t m_hot {};
+            std::unique_ptr<cold_t> m_cold;
+
+        public:
+            inline split_t() = default;
+            inline split_t(split_t&&) noexcept = default;
+
+            /**
+             * Copies a split tuple, including its cold part if it has been allocated.
+             * @param other The split tuple to be copied.
+             */
+            inline split_t(const split_t& other)
+              : m_hot (other.m_hot)
+              , m_cold (other.m_cold ? std::make_unique<cold_t>(*other.m_cold) : nullptr)
+            {}
+
+            /**
+             * Splits a tuple into its hot and cold parts.
+             * @param t The tuple to be split.
+             */
+            inline split_t(const value_t& t)
+              : m_hot (operation::get<H>(t)...)
+              , m_cold (std::make_unique<cold_t>(operation::get<C>(t)...))
+            {}
+
+            /**
+             * Splits a moving tuple into its hot and cold parts.
+             * @param t The tuple to be split.
+             */
+            inline split_t(value_t&& t)
+              : m_hot (operation::get<H>(std::move(t))...)
+              , m_cold (std::make_unique<cold_t>(operation::get<C>(std::move(t))...))
+            {}
+
+            /**
+             * Creates a split tuple from its elements, in their logical order.
+             * @tparam U The elements' types.
+             * @param value The elements to be split.
+             */
+            template <typename ...U, typename = std::enable_if_t<sizeof...(U) == count && (count > 1)>>
+            inline split_t(U&&... value)
+              : split_t (value_t(std::forward<U>(value)...))
+            {}
+
+            /**
+             * Copies a split tuple, including its cold part if it has been allocated.
+             * @param other The split tuple to be copied.
+             * @return The current split tuple.
+             */
+            inline split_t& operator=(const split_t& other)
+            {
+                if (this != &other) {
+                    m_cold = other.m_cold ? std::make_unique<cold_t>(*other.m_cold) : nullptr;
+                    m_hot = other.m_hot;
+                }
+
+                return *this;
+            }
+
+            inline split_t& operator=(split_t&&) noexcept = default;
+
+            /**
+             * Retrieves an element by its logical index. Writable references to cold
+             * elements allocate the cold part, if it has not been allocated yet.
+             * @tparam I The element's logical index.
+             * @return The reference to the element.
+             */
+            template <size_t I>
+            inline auto get() -> tuple_element_t<value_t, I>&
+            {
+                if constexpr (hot<I>) {
+                    return operation::get<detail::position<H...>(I)>(m_hot);
+                } else {
+                    return operation::get<detail::position<C...>(I)>(cold());
+                }
+            }
+
+            /**
+             * Retrieves a const-qualified element by its logical index. Cold elements
+             * which have never been written to are read from a shared default.
+             * @tparam I The element's logical index.
+             * @return The const-qualified reference to the element.
+             */
+            template <size_t I>
+            inline auto get() const -> const tuple_element_t<value_t, I>&
+            {
+                if constexpr (hot<I>) {
+                    return operation::get<detail::position<H...>(I)>(m_hot);
+                } else {
+                    return operation::get<detail::position<C...>(I)>(m_cold ? *m_cold : fallback());
+                }
+            }
+
+            /**
+             * Exposes the hot part of the tuple, which can be copied on its own.
+             * @return The tuple of hot elements.
+             */
+            inline hot_t& hot_part() noexcept { return m_hot; }
+            inline const hot_t& hot_part() const noexcept { return m_hot; }
+
+            /**
+             * Informs whether the cold part has been allocated.
+             * @return Has the cold part been allocated?
+             */
+            inline bool boxed() const noexcept
+            {
+                return m_cold != nullptr;
+            }
+
+            /**
+             * Gathers all elements back into a contiguous tuple.
+             * @return The tuple of all elements, in their logical order.
+             */
+            inline value_t gather() const
+            {
+                return gather(std::make_index_sequence<count>());
+            }
+
+            /**
+             * Compares two split tuples element-wise.
+             * @param other The split tuple to compare with.
+             * @return Are all elements equal?
+             */
+            inline bool operator==(const split_t& other) const
+            {
+                return m_hot == other.m_hot && cold_part() == other.cold_part();
+            }
+
+            inline bool operator!=(const split_t& other) const
+            {
+                return !operator==(other);
+            }
+
+        private:
+            /**
+             * Informs whether an element is hot, by its logical index.
+             * @tparam I The element's logical index.
+             */
+            template <size_t I>
+            static constexpr bool hot = detail::position<H...>(I) < sizeof...(H);
+
+            /**
+             * Retrieves the cold part, allocating it if needed.
+             * @return The cold part of the tuple.
+             */
+            inline cold_t& cold()
+            {
+                if (!m_cold) m_cold = std::make_unique<cold_t>();
+                return *m_cold;
+            }
+
+            /**
+             * Retrieves the cold part for reading, whether it has been allocated or not.
+             * @return The cold part of the tuple.
+             */
+            inline const cold_t& cold_part() const noexcept
+            {
+                return m_cold ? *m_cold : fallback();
+            }
+
+            /**
+             * The cold part of tuples which have never written to their cold elements.
+             * @return The default cold part.
+             */
+            inline static const cold_t& fallback() noexcept
+            {
+                static const cold_t instance {};
+                return instance;
+            }
+
+            /**
+             * Gathers all elements back into a contiguous tuple.
+             * @tparam I The tuple's sequence indeces.
+             * @return The tuple of all elements.
+             */
+            template <size_t ...I>
+            inline value_t gather(std::index_sequence<I...>) const
+            {
+                return value_t(get<I>()...);
+            }
+    };
+}
+
+/**
+ * Selects, by their compile-time indeces, the hot elements of a tuple, which are
+ * frequently accessed and should be kept inline. All other elements are cold, and
+ * are moved to an out-of-line allocation, so that large rarely accessed elements
+ * do not bloat copies of the tuple nor the cache lines touched by scans over it.
+ * @tparam I The indeces of the hot elements in the tuple.
+ * @since 1.0
+ */
+template <size_t ...I>
+struct split_tuple
+{
+    static_assert(sizeof...(I) > 0, "split tuples must keep at least one element inline");
+
+    /**
+     * The split tuple type for the given elements.
+     * @tparam T The tuple's element types.
+     * @since 1.0
+     */
+    template <typename ...T>
+    using type = detail::split_t<
+        std::index_sequence<I...>
+      , typename detail::complement_t<sizeof...(T), I...>::type
+      , T...>;
+};
+
+inline namespace operation
+{
+    /**
+     * Retrieves an element of a split tuple by its logical index.
+     * @tparam I The element's logical index.
+     * @tparam H The split tuple's hot indeces.
+     * @tparam C The split tuple's cold indeces.
+     * @tparam T The split tuple's element types.
+     * @param t The split tuple to retrieve the element from.
+     * @return The reference to the element.
+     */
+    template <size_t I, typename H, typename C, typename ...T>
+    inline decltype(auto) get(detail::split_t<H, C, T...>& t)
+    {
+        return t.template get<I>();
+    }
+
+    /**
+     * Retrieves a const-qualified element of a split tuple by its logical index.
+     * @tparam I The element's logical index.
+     * @tparam H The split tuple's hot indeces.
+     * @tparam C The split tuple's cold indeces.
+     * @tparam T The split tuple's element types.
+     * @param t The split tuple to retrieve the element from.
+     * @return The const-qualified reference to the element.
+     */
+    template <size_t I, typename H, typename C, typename ...T>
+    inline decltype(auto) get(const detail::split_t<H, C, T...>& t)
+    {
+        return t.template get<I>();
+    }
+
+    /**
+     * Retrieves an element of a moving split tuple by its logical index.
+     * @tparam I The element's logical index.
+     * @tparam H The split tuple's hot indeces.
+     * @tparam C The split tuple's cold indeces.
+     * @tparam T The split tuple's element types.
+     * @param t The split tuple to retrieve the element from.
+     * @return The element to be moved.
+     */
+    template <size_t I, typename H, typename C, typename ...T>
+    inline decltype(auto) get(detail::split_t<H, C, T...>&& t)
+    {
+        return std::move(t.template get<I>());
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
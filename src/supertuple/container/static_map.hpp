@@ -0,0 +1,282 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The compile-time perfect-hash static map implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/get.hpp>
+#include <supertuple/operation/hash.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The key type stored by a static map. Character pointers, which are the type
+     * of decayed string literals, are stored as views so they are hashed and compared
+     * by their contents rather than by their addresses.
+     * @tparam K The key type given to the map.
+     * @since 1.0
+     */
+    template <typename K>
+    using static_key_t = std::conditional_t<
+        std::is_same_v<std::decay_t<K>, const char*> || std::is_same_v<std::decay_t<K>, char*>
+      , std::string_view, K>;
+
+    /**
+     * Hashes a static map's key at compile-time.
+     * @tparam K The key's type.
+     * @param key The key to be hashed.
+     * @return The key's hash value.
+     */
+    template <typename K>
+    SUPERTUPLE_CONSTEXPR uint64_t static_hash(const K& key) noexcept
+    {
+        if constexpr (std::is_same_v<K, std::string_view>) {
+            uint64_t h = 0xcbf29ce484222325ULL;
+            for (char c : key) h = (h ^ (uint8_t) c) * 0x100000001b3ULL;
+            return detail::mix(h);
+        } else {
+            static_assert(std::is_integral_v<K> || std::is_enum_v<K>, "static map keys must be integers, enums or strings");
+            return detail::mix((uint64_t) key);
+        }
+    }
+
+    /**
+     * Computes the slot of a key within the map, from the key's hash and the seed
+     * of the key's bucket.
+     * @param hash The key's hash value.
+     * @param seed The seed of the key's bucket.
+     * @param n The number of slots in the map.
+     * @return The key's slot.
+     */
+    SUPERTUPLE_CONSTEXPR size_t static_slot(uint64_t hash, uint32_t seed, size_t n) noexcept
+    {
+        return (size_t) (detail::mix(hash + seed * 0x9e3779b97f4a7c15ULL) % n);
+    }
+}
+
+/**
+ * A read-only map built at compile-time from a constant tuple of key-value pairs.
+ * A minimal perfect hash is computed with the hash-and-displace method: keys are
+ * grouped in buckets by their hashes, and a seed is searched for each bucket so
+ * that its keys are displaced into slots not yet taken, largest buckets first. As
+ * there are as many slots as keys, a lookup probes a single slot and compares a
+ * single key. When declared as a constant expression, the whole map is stored in
+ * read-only data, with no initialization at startup.
+ * @tparam K The map's key type.
+ * @tparam V The map's mapped value type.
+ * @tparam N The map's number of keys.
+ * @since 1.0
+ */
+template <typename K, typename V, size_t N>
+class static_map
+{
+    public:
+        typedef K key_t;
+        typedef V value_t;
+
+    private:
+        static constexpr size_t buckets = N / 2 + 1;
+
+    private:
+        std::array<K, N> m_keys {};
+        std::array<V, N> m_values {};
+        std::array<uint32_t, buckets> m_seeds {};
+
+    public:
+        SUPERTUPLE_CONSTEXPR static_map(const static_map&) = default;
+        SUPERTUPLE_CONSTEXPR static_map(static_map&&) = default;
+
+        /**
+         * Builds the map from a tuple of key-value pairs.
+         * @tparam I The tuple's sequence indeces.
+         * @tparam T The pairs' key types.
+         * @tparam U The pairs' mapped value types.
+         * @param t The tuple of key-value pairs.
+         */
+        template <size_t ...I, typename ...T, typename ...U>
+        SUPERTUPLE_CONSTEXPR static_map(
+            const tuple_t<detail::identity_t<std::index_sequence<I...>>, pair_t<T, U>...>& t
+        ) {
+            static_assert(sizeof...(I) == N, "static map must be built from exactly N pairs");
+            const std::array<K, N> keys {K(operation::get<I>(t).first())...};
+            const std::array<V, N> values {V(operation::get<I>(t).second())...};
+            build(keys, values);
+        }
+
+        SUPERTUPLE_CONSTEXPR static_map& operator=(const static_map&) = default;
+        SUPERTUPLE_CONSTEXPR static_map& operator=(static_map&&) = default;
+
+        /**
+         * Searches for a key in the map.
+         * @param key The key to be searched.
+         * @return The key's mapped value, or null if the key is not in the map.
+         */
+        SUPERTUPLE_CONSTEXPR const V *find(const K& key) const noexcept
+        {
+            if constexpr (N == 0) {
+                return nullptr;
+            } else {
+                const size_t slot = locate(key);
+                return m_keys[slot] == key ? &m_values[slot] : nullptr;
+            }
+        }
+
+        /**
+         * Checks whether a key is in the map.
+         * @param key The key to be searched.
+         * @return Is the key in the map?
+         */
+        SUPERTUPLE_CONSTEXPR bool contains(const K& key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        /**
+         * Retrieves the value mapped to a key, or a fallback if the key is not in the map.
+         * @param key The key to be searched.
+         * @param fallback The value to be returned when the key is not found.
+         * @return The key's mapped value or the fallback.
+         */
+        SUPERTUPLE_CONSTEXPR V value_or(const K& key, const V& fallback) const noexcept
+        {
+            const V *value = find(key);
+            return value ? *value : fallback;
+        }
+
+        /**
+         * Informs the number of keys in the map.
+         * @return The map's number of keys.
+         */
+        SUPERTUPLE_CONSTEXPR size_t size() const noexcept
+        {
+            return N;
+        }
+
+    private:
+        /**
+         * Computes the slot in which a key would be stored in the map.
+         * @param key The key to be located.
+         * @return The key's slot.
+         */
+        SUPERTUPLE_CONSTEXPR size_t locate(const K& key) const noexcept
+        {
+            const uint64_t hash = detail::static_hash<K>(key);
+            return detail::static_slot(hash, m_seeds[hash % buckets], N);
+        }
+
+        /**
+         * Searches the seeds of all buckets and places the keys into their slots.
+         * @param keys The map's keys, in their original order.
+         * @param values The map's values, in their original order.
+         */
+        SUPERTUPLE_CONSTEXPR void build(const std::array<K, N>& keys, const std::array<V, N>& values)
+        {
+            std::array<uint64_t, N> hashes {};
+            std::array<size_t, N> order {};
+            std::array<size_t, buckets> sizes {};
+            std::array<bool, N> taken {};
+
+            for (size_t i = 0; i < N; ++i) {
+                hashes[i] = detail::static_hash<K>(keys[i]);
+                ++sizes[hashes[i] % buckets];
+                for (size_t j = 0; j < i; ++j)
+                    if (keys[j] == keys[i]) throw std::invalid_argument("static map keys must be unique");
+            }
+
+            // Orders the keys so that keys of larger buckets come first, as their seeds
+            // are the hardest to find and thus must be searched while most slots are free.
+            for (size_t i = 0; i < N; ++i) order[i] = i;
+            for (size_t i = 1; i < N; ++i)
+                for (size_t j = i; j > 0 && before(sizes, hashes, order[j], order[j - 1]); --j) {
+                    const size_t x = order[j]; order[j] = order[j - 1]; order[j - 1] = x;
+                }
+
+            for (size_t first = 0, last = 0; first < N; first = last) {
+                const size_t bucket = hashes[order[first]] % buckets;
+                for (last = first; last < N && hashes[order[last]] % buckets == bucket; ++last);
+
+                for (uint32_t seed = 0; ; ++seed) {
+                    if (!fits(hashes, order, taken, first, last, seed)) continue;
+
+                    for (size_t i = first; i < last; ++i) {
+                        const size_t slot = detail::static_slot(hashes[order[i]], seed, N);
+                        taken[slot] = true;
+                        m_keys[slot] = keys[order[i]];
+                        m_values[slot] = values[order[i]];
+                    }
+
+                    m_seeds[bucket] = seed;
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Checks whether a key must be placed before another one while building.
+         * @param sizes The number of keys in each bucket.
+         * @param hashes The keys' hash values.
+         * @param a The first key's index.
+         * @param b The second key's index.
+         * @return Must the first key be placed before the second one?
+         */
+        static SUPERTUPLE_CONSTEXPR bool before(
+            const std::array<size_t, buckets>& sizes, const std::array<uint64_t, N>& hashes
+          , size_t a, size_t b
+        ) noexcept {
+            const size_t x = hashes[a] % buckets, y = hashes[b] % buckets;
+            return sizes[x] != sizes[y] ? sizes[x] > sizes[y] : x < y;
+        }
+
+        /**
+         * Checks whether a seed displaces all keys of a bucket into distinct free slots.
+         * @param hashes The keys' hash values.
+         * @param order The keys' building order.
+         * @param taken The slots already taken.
+         * @param first The bucket's first key in the building order.
+         * @param last The bucket's end in the building order.
+         * @param seed The seed to be checked.
+         * @return Does the seed fit the bucket?
+         */
+        static SUPERTUPLE_CONSTEXPR bool fits(
+            const std::array<uint64_t, N>& hashes, const std::array<size_t, N>& order
+          , const std::array<bool, N>& taken, size_t first, size_t last, uint32_t seed
+        ) noexcept {
+            for (size_t i = first; i < last; ++i) {
+                const size_t slot = detail::static_slot(hashes[order[i]], seed, N);
+                if (taken[slot]) return false;
+                for (size_t j = first; j < i; ++j)
+                    if (detail::static_slot(hashes[order[j]], seed, N) == slot) return false;
+            }
+
+            return true;
+        }
+};
+
+/*
+ * Deduction guides for static maps.
+ * @since 1.0
+ */
+template <typename ...K, typename ...V>
+static_map(const tuple_t<pair_t<K, V>...>&)
+  -> static_map<detail::static_key_t<std::common_type_t<K...>>, std::common_type_t<V...>, sizeof...(K)>;
+
+template <typename K, typename V, size_t N>
+static_map(const ntuple_t<pair_t<K, V>, N>&)
+  -> static_map<detail::static_key_t<K>, V, N>;
+
+SUPERTUPLE_END_NAMESPACE
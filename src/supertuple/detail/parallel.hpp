@@ -0,0 +1,130 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Helpers for running kernels on multiple threads.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <supertuple/environment.h>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail::parallel
+{
+    /**
+     * Informs the number of threads to be used by default by parallel kernels.
+     * @return The number of hardware threads available.
+     */
+    inline size_t concurrency() noexcept
+    {
+        return std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * Joins a list of threads when leaving a scope, so that no joinable thread is
+     * ever destroyed, even if an error unwinds the scope.
+     * @since 1.0
+     */
+    class join_guard_t
+    {
+        private:
+            std::vector<std::thread>& m_threads;
+
+        public:
+            inline join_guard_t(const join_guard_t&) noexcept = delete;
+            inline join_guard_t(join_guard_t&&) noexcept = delete;
+
+            /**
+             * Guards a list of threads to be joined.
+             * @param threads The threads to be joined.
+             */
+            inline explicit join_guard_t(std::vector<std::thread>& threads) noexcept
+              : m_threads (threads)
+            {}
+
+            /**
+             * Joins all of the guarded threads which are still joinable.
+             */
+            inline ~join_guard_t()
+            {
+                for (auto& thread : m_threads)
+                    if (thread.joinable()) thread.join();
+            }
+
+            inline join_guard_t& operator=(const join_guard_t&) noexcept = delete;
+            inline join_guard_t& operator=(join_guard_t&&) noexcept = delete;
+    };
+
+    /**
+     * Runs a kernel on the given number of threads and waits for all of them. The
+     * calling thread takes part as the first worker, so a single-threaded run does
+     * not spawn any thread at all. If the kernel throws on any thread, all threads
+     * are still waited for, and the first error is then rethrown to the caller.
+     * @tparam F The kernel functor type.
+     * @param threads The number of threads to run the kernel on.
+     * @param lambda The kernel to be invoked with each worker's index.
+     */
+    template <typename F>
+    inline void run(size_t threads, const F& lambda)
+    {
+        std::exception_ptr error;
+        std::mutex mutex;
+
+        auto guarded = [&](size_t id) {
+            try {
+                lambda(id);
+            } catch (...) {
+                std::lock_guard lock (mutex);
+                if (!error) error = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::thread> workers;
+            join_guard_t guard (workers);
+            workers.reserve(threads > 1 ? threads - 1 : 0);
+
+            for (size_t id = 1; id < threads; ++id)
+                workers.emplace_back([&guarded, id]() { guarded(id); });
+
+            guarded(size_t(0));
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    /**
+     * Distributes the indeces of a range among threads in chunks taken on demand,
+     * so that uneven tasks are balanced without any locks.
+     * @tparam F The task functor type.
+     * @param threads The number of threads to run the tasks on.
+     * @param count The number of tasks to be run.
+     * @param lambda The task to be invoked with each index and worker's index.
+     * @param grain The number of consecutive indeces taken at once.
+     */
+    template <typename F>
+    inline void each(size_t threads, size_t count, const F& lambda, size_t grain = 1)
+    {
+        std::atomic<size_t> next {0};
+        grain = std::max<size_t>(1, grain);
+        threads = std::max<size_t>(1, std::min(threads, (count + grain - 1) / grain));
+
+        parallel::run(threads, [&](size_t id) {
+            for (size_t first; (first = next.fetch_add(grain, std::memory_order_relaxed)) < count; )
+                for (size_t i = first, last = std::min(first + grain, count); i < last; ++i)
+                    lambda(i, id);
+        });
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
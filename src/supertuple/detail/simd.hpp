@@ -0,0 +1,371 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Portable vector types and helpers for data-parallel kernels.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <supertuple/environment.h>
+
+/*
+ * Checks whether vector types can be used by data-parallel kernels. We rely on the
+ * vector extensions provided by both GCC and Clang, which are lowered to whatever
+ * instruction set is enabled on the target, so that no intrinsics are needed. When
+ * not available, every kernel must provide a scalar alternative.
+ */
+#if !defined(SUPERTUPLE_DISABLE_SIMD) && !defined(__CUDA_ARCH__)
+  #if (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_GCC) || (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_CLANG)
+    #define SUPERTUPLE_SIMD_ENABLED
+  #endif
+#endif
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail::simd
+{
+    /**
+     * The width, in bytes, of the widest vector registers enabled on the target.
+     * @since 1.0
+     */
+  #if defined(__AVX512F__)
+    inline constexpr size_t width = 64;
+  #elif defined(__AVX__)
+    inline constexpr size_t width = 32;
+  #else
+    inline constexpr size_t width = 16;
+  #endif
+
+    /**
+     * Whether a type can be the lanes' type of a vector. Only arithmetic types with
+     * the size of an integer mask lane are allowed, so that wider types, such as
+     * `long double`, are always handled by the scalar alternative of a kernel.
+     * @tparam T The type to be checked.
+     * @since 1.0
+     */
+    template <typename T>
+    inline constexpr bool vectorizable_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>
+        && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+  #if defined(SUPERTUPLE_SIMD_ENABLED)
+    /**
+     * Builds a vector type with the given number of lanes.
+     * @tparam T The vector's lanes' type.
+     * @tparam L The number of lanes in the vector.
+     * @since 1.0
+     */
+    template <typename T, size_t L>
+    struct vector_builder_t
+    {
+        static_assert(vectorizable_v<T>, "vector lanes must have an arithmetic type of 1, 2, 4 or 8 bytes");
+        typedef T type __attribute__((vector_size(sizeof(T) * L)));
+    };
+
+    /**
+     * A vector of arithmetic lanes. All arithmetic and comparison operators act
+     * lane-wise, and comparisons produce masks of same-sized signed integers.
+     * @tparam T The vector's lanes' type.
+     * @tparam L The number of lanes in the vector.
+     * @since 1.0
+     */
+    template <typename T, size_t L = width / sizeof(T)>
+    using vector_t = typename vector_builder_t<T, L>::type;
+
+    /**
+     * The signed integer type of a vector's comparison mask lanes.
+     * @tparam T The vector's lanes' type.
+     * @since 1.0
+     */
+    template <typename T>
+    using mask_lane_t =
+        std::conditional_t<sizeof(T) == 1, int8_t,
+        std::conditional_t<sizeof(T) == 2, int16_t,
+        std::conditional_t<sizeof(T) == 4, int32_t,
+        std::conditional_t<sizeof(T) == 8, int64_t, void>>>>;
+
+    /**
+     * The type of comparison masks produced by a vector type.
+     * @tparam T The vector's lanes' type.
+     * @tparam L The number of lanes in the vector.
+     * @since 1.0
+     */
+    template <typename T, size_t L = width / sizeof(T)>
+    using mask_t = vector_t<mask_lane_t<T>, L>;
+
+    /**
+     * Loads a vector from a possibly unaligned memory location.
+     * @tparam V The vector type to be loaded.
+     * @tparam T The type of the lanes in memory.
+     * @param ptr The memory location to load the vector from.
+     * @return The loaded vector.
+     */
+    template <typename V, typename T>
+    inline V load(const T *ptr) noexcept
+    {
+        V result;
+        std::memcpy(&result, ptr, sizeof(V));
+        return result;
+    }
+
+    /**
+     * Stores a vector into a possibly unaligned memory location.
+     * @tparam V The vector type to be stored.
+     * @tparam T The type of the lanes in memory.
+     * @param ptr The memory location to store the vector into.
+     * @param value The vector to be stored.
+     */
+    template <typename V, typename T>
+    inline void store(T *ptr, const V& value) noexcept
+    {
+        std::memcpy(ptr, &value, sizeof(V));
+    }
+
+    /**
+     * Creates a vector with all lanes set to the same value.
+     * @tparam V The vector type to be created.
+     * @tparam T The value's type.
+     * @param value The value to broadcast to all lanes.
+     * @return The new vector.
+     */
+    template <typename V, typename T>
+    inline V broadcast(const T& value) noexcept
+    {
+        return V {} + value;
+    }
+
+    /**
+     * Selects lanes from two vectors according to a comparison mask.
+     * @tparam V The vectors' type.
+     * @tparam M The mask's type.
+     * @param mask The mask selecting lanes from the first vector.
+     * @param a The vector to take the lanes selected by the mask from.
+     * @param b The vector to take the remaining lanes from.
+     * @return The blended vector.
+     */
+    template <typename V, typename M>
+    inline V select(const M& mask, const V& a, const V& b) noexcept
+    {
+        return (V) ((mask & (M) a) | (~mask & (M) b));
+    }
+
+    /**
+     * Checks whether any lane of a comparison mask is set.
+     * @tparam M The mask's type.
+     * @param mask The mask to be checked.
+     * @return Is any of the mask's lanes set?
+     */
+    template <typename M>
+    inline bool any(const M& mask) noexcept
+    {
+        constexpr size_t lanes = sizeof(M) / sizeof(mask[0]);
+        auto bits = mask[0];
+        for (size_t i = 1; i < lanes; ++i) bits |= mask[i];
+        return bits != 0;
+    }
+
+    /**
+     * Checks whether all lanes of a comparison mask are set.
+     * @tparam M The mask's type.
+     * @param mask The mask to be checked.
+     * @return Are all of the mask's lanes set?
+     */
+    template <typename M>
+    inline bool all(const M& mask) noexcept
+    {
+        return !simd::any(~mask);
+    }
+
+    /**
+     * Counts the number of set lanes in a comparison mask.
+     * @tparam M The mask's type.
+     * @param mask The mask to be counted.
+     * @return The number of set lanes.
+     */
+    template <typename M>
+    inline size_t count(const M& mask) noexcept
+    {
+        constexpr size_t lanes = sizeof(M) / sizeof(mask[0]);
+        M acc = -mask;
+        size_t total = 0;
+        for (size_t i = 0; i < lanes; ++i) total += (size_t) acc[i];
+        return total;
+    }
+  #endif
+
+    /**
+     * Counts how many values in a sequence are ordered before a given value. When
+     * the sequence is sorted, this is the position of the value's lower bound, and
+     * can be computed without any branches by comparing whole vectors at once.
+     * @tparam E Whether elements equivalent to the value must also be counted.
+     * @tparam T The sequence's elements' type.
+     * @tparam U The value's type.
+     * @param data The sequence's first element.
+     * @param n The number of elements in the sequence.
+     * @param value The value to compare the sequence's elements with.
+     * @return The number of elements lesser than (or equivalent to) the value.
+     */
+    template <bool E = false, typename T, typename U>
+    inline size_t rank(const T *data, size_t n, const U& value) noexcept
+    {
+        size_t i = 0, total = 0;
+
+      #if defined(SUPERTUPLE_SIMD_ENABLED)
+        if constexpr (simd::vectorizable_v<T> && std::is_same_v<T, std::decay_t<U>>) {
+            using vector_t = simd::vector_t<T>;
+            using mask_t = simd::mask_t<T>;
+            constexpr size_t lanes = sizeof(vector_t) / sizeof(T);
+            constexpr size_t limit = lanes * 127;
+
+            const auto pivot = simd::broadcast<vector_t>(value);
+
+            while (i + lanes <= n) {
+                const size_t last = std::min(i + limit, n - (n - i) % lanes);
+                mask_t acc {};
+
+                for (; i < last; i += lanes) {
+                    const auto v = simd::load<vector_t>(data + i);
+                    if constexpr (E) acc -= (mask_t) (v <= pivot);
+                    else             acc -= (mask_t) (v < pivot);
+                }
+
+                for (size_t j = 0; j < lanes; ++j)
+                    total += (size_t) acc[j];
+            }
+        }
+      #endif
+
+        for (; i < n; ++i)
+            total += E ? !(value < data[i]) : (data[i] < value);
+
+        return total;
+    }
+
+    /**
+     * Finds the first element of a sequence that is equal to a given value. Whole
+     * vectors are compared at once, and only a vector with a match is looked into.
+     * @tparam T The sequence's elements' type.
+     * @tparam U The value's type.
+     * @param data The sequence's first element.
+     * @param n The number of elements in the sequence.
+     * @param value The value to be found.
+     * @return The index of the first matching element, or the sequence's size.
+     */
+    template <typename T, typename U>
+    inline size_t find(const T *data, size_t n, const U& value) noexcept
+    {
+        size_t i = 0;
+
+      #if defined(SUPERTUPLE_SIMD_ENABLED)
+        if constexpr (simd::vectorizable_v<T> && std::is_same_v<T, std::decay_t<U>>) {
+            using vector_t = simd::vector_t<T>;
+            using mask_t = simd::mask_t<T>;
+            constexpr size_t lanes = sizeof(vector_t) / sizeof(T);
+
+            const auto pivot = simd::broadcast<vector_t>(value);
+
+            for (; i + lanes <= n; i += lanes) {
+                const auto mask = (mask_t) (simd::load<vector_t>(data + i) == pivot);
+                if (simd::any(mask))
+                    for (size_t j = 0; j < lanes; ++j)
+                        if (mask[j]) return i + j;
+            }
+        }
+      #endif
+
+        for (; i < n; ++i)
+            if (data[i] == value) return i;
+
+        return n;
+    }
+
+    /**
+     * Finds the extreme value in a non-empty sequence. Arithmetic sequences keep one
+     * running extreme per vector lane, blending in each new vector by a comparison
+     * mask, and only reduce the lanes at the end. Elements that are not ordered with
+     * themselves, such as NaNs, never become the extreme but may poison the result.
+     * @tparam G Must the greatest value be found instead of the least?
+     * @tparam P Must a NaN result if any of the elements is a NaN?
+     * @tparam T The sequence's elements' type.
+     * @param data The sequence's first element.
+     * @param n The number of elements in the sequence.
+     * @return The sequence's extreme value, or NaN if there is no such value.
+     */
+    template <bool G, bool P, typename T>
+    inline T extreme(const T *data, size_t n) noexcept
+    {
+        auto better = [](const T& a, const T& b) { return G ? b < a : a < b; };
+
+        if constexpr (!std::is_arithmetic_v<T>) {
+            const T *best = data;
+            for (size_t i = 1; i < n; ++i)
+                if (better(data[i], *best)) best = &data[i];
+            return *best;
+        } else {
+            constexpr bool floating = std::is_floating_point_v<T>;
+            using limits_t = std::numeric_limits<T>;
+
+            T best = G ? (floating ? -limits_t::infinity() : limits_t::lowest())
+                       : (floating ?  limits_t::infinity() : limits_t::max());
+
+            bool nan = false, valid = !floating;
+            size_t i = 0;
+
+          #if defined(SUPERTUPLE_SIMD_ENABLED)
+            if constexpr (simd::vectorizable_v<T>) {
+                using vector_t = simd::vector_t<T>;
+                using mask_t = simd::mask_t<T>;
+                constexpr size_t lanes = sizeof(vector_t) / sizeof(T);
+
+                auto acc = simd::broadcast<vector_t>(best);
+                mask_t nans {}, valids {};
+
+                for (; i + lanes <= n; i += lanes) {
+                    const auto v = simd::load<vector_t>(data + i);
+                    if constexpr (G) acc = simd::select((mask_t) (v > acc), v, acc);
+                    else             acc = simd::select((mask_t) (v < acc), v, acc);
+                    if constexpr (floating) nans |= (mask_t) (v != v), valids |= (mask_t) (v == v);
+                }
+
+                for (size_t j = 0; j < lanes; ++j)
+                    if (better(acc[j], best)) best = acc[j];
+
+                nan = simd::any(nans);
+                valid = valid || simd::any(valids);
+            }
+          #endif
+
+            for (; i < n; ++i) {
+                if (data[i] != data[i]) { nan = true; continue; }
+                if (better(data[i], best)) best = data[i];
+                valid = true;
+            }
+
+            if constexpr (floating)
+                if ((P && nan) || !valid) return limits_t::quiet_NaN();
+
+            return best;
+        }
+    }
+
+    /**
+     * Hints the processor to bring a memory location into cache.
+     * @param ptr The memory location to be prefetched.
+     */
+    inline void prefetch(const void *ptr) noexcept
+    {
+      #if (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_GCC) || (SUPERTUPLE_COMPILER == SUPERTUPLE_OPT_COMPILER_CLANG)
+        __builtin_prefetch(ptr);
+      #else
+        (void) ptr;
+      #endif
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
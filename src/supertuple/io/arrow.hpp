@@ -0,0 +1,439 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The Arrow C Data Interface export and import implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/container/column_view.hpp>
+#include <supertuple/container/soa.hpp>
+#include <supertuple/operation/get.hpp>
+
+/*
+ * The structures of the Arrow C Data Interface, as defined by its stable ABI. They
+ * are guarded by the same macro used by the specification, so that they can coexist
+ * with definitions provided by any Arrow implementation.
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema
+{
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+    void (*release)(struct ArrowSchema*);
+    void *private_data;
+};
+
+struct ArrowArray
+{
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+    void (*release)(struct ArrowArray*);
+    void *private_data;
+};
+
+}
+
+#endif
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Informs the Arrow format string of a primitive column's element type.
+     * @tparam T The column's element type.
+     * @return The element type's format string.
+     */
+    template <typename T>
+    SUPERTUPLE_CONSTEXPR const char *arrow_format() noexcept
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>
+          , "only arithmetic columns can be exchanged without copies");
+
+        if constexpr (std::is_floating_point_v<T>) {
+            static_assert(sizeof(T) == 4 || sizeof(T) == 8, "only binary32 and binary64 columns are supported");
+            return sizeof(T) == 4 ? "f" : "g";
+        } else if constexpr (std::is_signed_v<T>) {
+            return sizeof(T) == 1 ? "c" : sizeof(T) == 2 ? "s" : sizeof(T) == 4 ? "i" : "l";
+        } else {
+            return sizeof(T) == 1 ? "C" : sizeof(T) == 2 ? "S" : sizeof(T) == 4 ? "I" : "L";
+        }
+    }
+
+    /**
+     * The memory behind an exported schema of a struct of primitive columns.
+     * @tparam N The number of columns.
+     * @since 1.0
+     */
+    template <size_t N>
+    struct arrow_schema_private_t
+    {
+        std::array<std::string, N> names;
+        std::array<ArrowSchema, N> children;
+        std::array<ArrowSchema*, N> pointers;
+    };
+
+    /**
+     * The memory behind an exported array of a struct of primitive columns. When the
+     * exported table is owned by the array, it is kept alive until the array is
+     * released, as the columns' buffers point into it.
+     * @tparam T The columns' element types.
+     * @since 1.0
+     */
+    template <typename ...T>
+    struct arrow_array_private_t
+    {
+        std::unique_ptr<soa_t<T...>> owned;
+        std::array<ArrowArray, sizeof...(T)> children;
+        std::array<ArrowArray*, sizeof...(T)> pointers;
+        std::array<std::array<const void*, 2>, sizeof...(T)> buffers;
+        std::array<const void*, 1> validity = {nullptr};
+    };
+
+    /**
+     * Releases an exported child schema, whose memory is owned by its parent.
+     * @param schema The schema to be released.
+     */
+    inline void arrow_release_child(ArrowSchema *schema) noexcept
+    {
+        schema->release = nullptr;
+    }
+
+    /**
+     * Releases an exported child array, whose memory is owned by its parent.
+     * @param array The array to be released.
+     */
+    inline void arrow_release_child(ArrowArray *array) noexcept
+    {
+        array->release = nullptr;
+    }
+
+    /**
+     * Releases an exported schema and all of its children.
+     * @tparam N The number of columns.
+     * @param schema The schema to be released.
+     */
+    template <size_t N>
+    inline void arrow_release_schema(ArrowSchema *schema) noexcept
+    {
+        auto data = static_cast<arrow_schema_private_t<N>*>(schema->private_data);
+        for (auto& child : data->children) if (child.release) child.release(&child);
+        delete data;
+        schema->release = nullptr;
+    }
+
+    /**
+     * Releases an exported array and all of its children.
+     * @tparam T The columns' element types.
+     * @param array The array to be released.
+     */
+    template <typename ...T>
+    inline void arrow_release_array(ArrowArray *array) noexcept
+    {
+        auto data = static_cast<arrow_array_private_t<T...>*>(array->private_data);
+        for (auto& child : data->children) if (child.release) child.release(&child);
+        delete data;
+        array->release = nullptr;
+    }
+
+    /**
+     * Points the exported children arrays to the columns of a table.
+     * @tparam T The columns' element types.
+     * @tparam I The columns' indeces.
+     * @param data The exported array's memory.
+     * @param table The table to be exported.
+     */
+    template <typename ...T, size_t ...I>
+    inline void arrow_fill(arrow_array_private_t<T...>& data, const soa_t<T...>& table, std::index_sequence<I...>)
+    {
+        ((data.buffers[I] = {nullptr, table.template column<I>().data()}), ...);
+
+        for (size_t i = 0; i < sizeof...(T); ++i) {
+            data.children[i] = ArrowArray {
+                (int64_t) table.size(), 0, 0, 2, 0, data.buffers[i].data()
+              , nullptr, nullptr, &arrow_release_child, nullptr};
+            data.pointers[i] = &data.children[i];
+        }
+    }
+
+    /**
+     * Exports the columns of a table, owned or not by the exported array.
+     * @tparam T The columns' element types.
+     * @param table The table to be exported.
+     * @param owned The table owned by the exported array, if any.
+     * @param out The array to be exported into.
+     */
+    template <typename ...T>
+    inline void arrow_export(const soa_t<T...>& table, std::unique_ptr<soa_t<T...>> owned, ArrowArray *out)
+    {
+        auto data = std::make_unique<arrow_array_private_t<T...>>();
+        data->owned = std::move(owned);
+        arrow_fill(*data, table, std::index_sequence_for<T...>());
+
+        *out = ArrowArray {
+            (int64_t) table.size(), 0, 0, 1, (int64_t) sizeof...(T), data->validity.data()
+          , data->pointers.data(), nullptr, &arrow_release_array<T...>, data.get()};
+
+        data.release();
+    }
+}
+
+namespace io
+{
+    /**
+     * Exports the schema of a table of tuples through the Arrow C Data Interface, as
+     * a struct whose fields are the table's columns. The fields' formats are derived
+     * from the columns' element types, and the fields are named by their indeces
+     * unless names are given.
+     * @tparam T The columns' element types.
+     * @param out The schema to be exported into, to be released by its consumer.
+     * @param names The columns' names, if any.
+     */
+    template <typename ...T>
+    inline void export_schema(ArrowSchema *out, const std::vector<std::string>& names = {})
+    {
+        constexpr size_t N = sizeof...(T);
+        constexpr const char *formats[] = {detail::arrow_format<T>()..., nullptr};
+
+        if (!names.empty() && names.size() != N)
+            throw std::invalid_argument("there must be a name for every column");
+
+        auto data = std::make_unique<detail::arrow_schema_private_t<N>>();
+
+        for (size_t i = 0; i < N; ++i) {
+            data->names[i] = names.empty() ? std::to_string(i) : names[i];
+            data->children[i] = ArrowSchema {
+                formats[i], data->names[i].c_str(), nullptr, 0, 0, nullptr, nullptr
+              , &detail::arrow_release_child, nullptr};
+            data->pointers[i] = &data->children[i];
+        }
+
+        *out = ArrowSchema {
+            "+s", "", nullptr, 0, (int64_t) N, data->pointers.data(), nullptr
+          , &detail::arrow_release_schema<N>, data.get()};
+
+        data.release();
+    }
+
+    /**
+     * Exports the columns of a table of tuples through the Arrow C Data Interface,
+     * without copying them. The table must outlive the exported array and must not
+     * be modified until the array is released by its consumer.
+     * @tparam T The columns' element types.
+     * @param table The table to be exported.
+     * @param out The array to be exported into, to be released by its consumer.
+     */
+    template <typename ...T>
+    inline void export_array(const soa_t<T...>& table, ArrowArray *out)
+    {
+        detail::arrow_export(table, std::unique_ptr<soa_t<T...>>(), out);
+    }
+
+    /**
+     * Exports the columns of a moving table of tuples through the Arrow C Data
+     * Interface, without copying them. The table is owned by the exported array, and
+     * is destroyed when the array is released by its consumer.
+     * @tparam T The columns' element types.
+     * @param table The table to be exported.
+     * @param out The array to be exported into, to be released by its consumer.
+     */
+    template <typename ...T>
+    inline void export_array(soa_t<T...>&& table, ArrowArray *out)
+    {
+        auto owned = std::make_unique<soa_t<T...>>(std::move(table));
+        const soa_t<T...>& ref = *owned;
+        detail::arrow_export(ref, std::move(owned), out);
+    }
+
+    /**
+     * A table of tuples imported through the Arrow C Data Interface. The imported
+     * array is owned by the table, which releases it when destroyed, and its buffers
+     * are exposed as column views without being copied.
+     * @tparam T The columns' element types.
+     * @since 1.0
+     */
+    template <typename ...T>
+    class arrow_table_t
+    {
+        public:
+            typedef tuple_t<T...> row_t;
+            static constexpr size_t count = sizeof...(T);
+
+        private:
+            ArrowArray m_array {};
+            std::array<const void*, count> m_columns {};
+
+        public:
+            inline arrow_table_t(const arrow_table_t&) = delete;
+
+            /**
+             * Takes ownership of an imported array, moving it out of the given structure
+             * as prescribed by the interface, after validating its layout.
+             * @param schema The schema describing the array.
+             * @param array The array to be imported, which is left released.
+             */
+            inline arrow_table_t(const ArrowSchema& schema, ArrowArray *array)
+              : m_array (*array)
+            {
+                array->release = nullptr;
+                validate(schema, std::index_sequence_for<T...>());
+            }
+
+            /**
+             * Moves an imported table into a new instance.
+             * @param other The table to be moved.
+             */
+            inline arrow_table_t(arrow_table_t&& other) noexcept
+              : m_array (other.m_array)
+              , m_columns (other.m_columns)
+            {
+                other.m_array.release = nullptr;
+            }
+
+            /**
+             * Releases the imported array.
+             */
+            inline ~arrow_table_t()
+            {
+                if (m_array.release) m_array.release(&m_array);
+            }
+
+            inline arrow_table_t& operator=(const arrow_table_t&) = delete;
+            inline arrow_table_t& operator=(arrow_table_t&&) = delete;
+
+            /**
+             * Exposes a column of the imported table.
+             * @tparam I The column index.
+             * @return The view over the column's elements.
+             */
+            template <size_t I>
+            inline auto column() const noexcept
+            {
+                using element_t = tuple_element_t<row_t, I>;
+                return column_view_t<const element_t>(
+                    static_cast<const element_t*>(m_columns[I]), size(), (std::ptrdiff_t) sizeof(element_t));
+            }
+
+            /**
+             * Gathers a row of the imported table into a tuple.
+             * @param i The row index.
+             * @return The row's tuple.
+             */
+            inline row_t gather(size_t i) const noexcept
+            {
+                return gather(i, std::index_sequence_for<T...>());
+            }
+
+            /**
+             * Informs the number of rows in the imported table.
+             * @return The number of rows.
+             */
+            inline size_t size() const noexcept
+            {
+                return (size_t) m_array.length;
+            }
+
+        private:
+            /**
+             * Checks whether the imported array matches the table's columns, and finds
+             * the columns' first elements. On failure, the array is released.
+             * @tparam I The columns' indeces.
+             * @param schema The schema describing the array.
+             */
+            template <size_t ...I>
+            inline void validate(const ArrowSchema& schema, std::index_sequence<I...>)
+            {
+                constexpr const char *formats[] = {detail::arrow_format<T>()..., nullptr};
+
+                auto fail = [&](const char *message) {
+                    if (m_array.release) m_array.release(&m_array);
+                    throw std::runtime_error(message);
+                };
+
+                if (m_array.release == nullptr)
+                    throw std::invalid_argument("cannot import a released array");
+                if (std::strcmp(schema.format, "+s") != 0 || schema.n_children != (int64_t) count)
+                    fail("the imported schema does not match the table's columns");
+                if (m_array.n_children != (int64_t) count || m_array.null_count > 0)
+                    fail("the imported array does not match the table's columns");
+
+                for (size_t i = 0; i < count; ++i) {
+                    const ArrowSchema& field = *schema.children[i];
+                    const ArrowArray& child = *m_array.children[i];
+
+                    if (std::strcmp(field.format, formats[i]) != 0)
+                        fail("the imported column's type does not match the table's");
+                    if (child.n_buffers != 2 || child.null_count > 0 || child.buffers[0] != nullptr)
+                        fail("only columns without nulls can be imported");
+                    if (child.length < m_array.offset + m_array.length)
+                        fail("the imported column is shorter than its parent");
+                }
+
+                ((m_columns[I] = static_cast<const tuple_element_t<row_t, I>*>(m_array.children[I]->buffers[1])
+                    + m_array.children[I]->offset + m_array.offset), ...);
+            }
+
+            /**
+             * Gathers a row of the imported table into a tuple.
+             * @tparam I The columns' indeces.
+             * @param i The row index.
+             * @return The row's tuple.
+             */
+            template <size_t ...I>
+            inline row_t gather(size_t i, std::index_sequence<I...>) const noexcept
+            {
+                return row_t(column<I>()[i]...);
+            }
+    };
+
+    /**
+     * Imports a table of tuples through the Arrow C Data Interface, without copying
+     * its columns. The array is moved into the imported table, and must describe a
+     * struct of primitive columns without nulls, whose types match the table's.
+     * @tparam T The columns' element types.
+     * @param schema The schema describing the array, still owned by the caller.
+     * @param array The array to be imported, which is left released.
+     * @return The imported table.
+     */
+    template <typename ...T>
+    inline arrow_table_t<T...> import_array(const ArrowSchema& schema, ArrowArray *array)
+    {
+        return arrow_table_t<T...>(schema, array);
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
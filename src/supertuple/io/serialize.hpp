@@ -0,0 +1,131 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The compact binary tuple record format implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include <type_traits>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace io
+{
+    /**
+     * Informs the number of bytes a tuple record occupies when encoded. As elements
+     * are packed one after the other, there is no padding between elements.
+     * @tparam T The tuple type to be encoded.
+     * @since 1.0
+     */
+    template <typename T>
+    struct record_size_t;
+
+    /**
+     * Computes the packed size of a tuple record from its elements' types.
+     * @tparam T The tuple's element members types.
+     * @since 1.0
+     */
+    template <typename ...T>
+    struct record_size_t<tuple_t<T...>>
+      : std::integral_constant<size_t, (sizeof(T) + ... + 0)>
+    {
+        static_assert(
+            (std::is_trivially_copyable_v<T> && ...)
+          , "only tuples of trivially copyable elements can be encoded");
+    };
+
+    /**
+     * The packed size of a tuple record of the given type.
+     * @tparam T The tuple type to be encoded.
+     * @since 1.0
+     */
+    template <typename T>
+    inline constexpr size_t record_size_v = record_size_t<typename T::base_tuple_t>::value;
+
+    /**
+     * Encodes a tuple into a raw memory buffer, packing its elements' bytes in
+     * order without any padding. The buffer must be at least the record size long.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param out The buffer to encode the tuple into.
+     * @param t The tuple to be encoded.
+     * @return The buffer position right after the encoded record.
+     */
+    template <size_t ...I, typename ...T>
+    inline std::byte *encode(
+        std::byte *out
+      , const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) noexcept {
+        static_assert((std::is_trivially_copyable_v<T> && ...)
+          , "only tuples of trivially copyable elements can be encoded");
+        ((std::memcpy(out, &operation::get<I>(t), sizeof(T)), out += sizeof(T)), ...);
+        return out;
+    }
+
+    /**
+     * Decodes a tuple from a raw memory buffer previously written by an encoding.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param in The buffer to decode the tuple from.
+     * @param t The tuple to decode the record into.
+     * @return The buffer position right after the decoded record.
+     */
+    template <size_t ...I, typename ...T>
+    inline const std::byte *decode(
+        const std::byte *in
+      , tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) noexcept {
+        static_assert((std::is_trivially_copyable_v<T> && ...)
+          , "only tuples of trivially copyable elements can be decoded");
+        ((std::memcpy(&operation::get<I>(t), in, sizeof(T)), in += sizeof(T)), ...);
+        return in;
+    }
+
+    /**
+     * Encodes a batch of tuples at the end of a byte buffer.
+     * @tparam T The type of tuples in the batch.
+     * @param out The byte buffer to append the batch to.
+     * @param first The pointer to the batch's first tuple.
+     * @param count The number of tuples in the batch.
+     */
+    template <typename T>
+    inline void encode(std::vector<std::byte>& out, const T *first, size_t count)
+    {
+        const size_t offset = out.size();
+        out.resize(offset + count * record_size_v<T>);
+
+        std::byte *cursor = out.data() + offset;
+
+        for (size_t i = 0; i < count; ++i)
+            cursor = io::encode(cursor, first[i]);
+    }
+
+    /**
+     * Decodes a batch of tuples from a raw memory buffer.
+     * @tparam T The type of tuples in the batch.
+     * @param in The buffer to decode the batch from.
+     * @param first The pointer to where the decoded tuples must be written to.
+     * @param count The number of tuples to be decoded.
+     * @return The buffer position right after the decoded batch.
+     */
+    template <typename T>
+    inline const std::byte *decode(const std::byte *in, T *first, size_t count) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            in = io::decode(in, first[i]);
+        return in;
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,713 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The asynchronous tuple record sink implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include <supertuple/environment.h>
+#include <supertuple/io/serialize.hpp>
+
+/*
+ * Checks whether the io_uring interface can be used as the asynchronous sink's backend.
+ * The interface is accessed via raw system calls, so we only need the kernel's headers
+ * to be available. Otherwise, or if explicitly disabled, the synchronous fallback is used.
+ */
+#if !defined(SUPERTUPLE_DISABLE_IO_URING) && defined(__linux__) && __has_include(<linux/io_uring.h>)
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <linux/io_uring.h>
+  #if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+    #define SUPERTUPLE_IO_URING_ENABLED
+  #endif
+#endif
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace io
+{
+    /**
+     * The configuration options of an asynchronous sink.
+     * @since 1.0
+     */
+    struct sink_options_t
+    {
+        size_t max_inflight_bytes = size_t(64) << 20;
+        unsigned queue_depth = 64;
+        bool allow_uring = true;
+        bool truncate = true;
+    };
+}
+
+namespace detail
+{
+    /**
+     * A single operation queued on an asynchronous sink. Writes own the buffer
+     * they must write, so callers never have to keep it alive.
+     * @since 1.0
+     */
+    struct sink_request_t
+    {
+        typedef std::function<void(std::error_code, size_t)> callback_t;
+
+        bool sync = false;
+        size_t offset = 0;
+        size_t done = 0;
+        std::vector<std::byte> buffer;
+        callback_t callback;
+        struct iovec iov {};
+    };
+
+  #if defined(SUPERTUPLE_IO_URING_ENABLED)
+    /**
+     * A minimal io_uring instance, set up with raw system calls. The ring is only
+     * ever touched by the sink's worker thread, so no synchronization is needed
+     * other than the memory ordering required by the kernel's shared indeces.
+     * @since 1.0
+     */
+    class uring_t
+    {
+        private:
+            int m_fd = -1;
+            void *m_sq_ptr = nullptr, *m_cq_ptr = nullptr;
+            size_t m_sq_size = 0, m_cq_size = 0, m_sqes_size = 0;
+            unsigned *m_sq_head, *m_sq_tail, *m_sq_mask, *m_sq_entries, *m_sq_array;
+            unsigned *m_cq_head, *m_cq_tail, *m_cq_mask;
+            struct io_uring_sqe *m_sqes = nullptr;
+            struct io_uring_cqe *m_cqes = nullptr;
+            unsigned m_local_tail = 0;
+            unsigned m_unsubmitted = 0;
+
+        public:
+            inline uring_t() noexcept = default;
+            inline uring_t(const uring_t&) noexcept = delete;
+            inline uring_t(uring_t&&) noexcept = delete;
+
+            /**
+             * Releases the ring and all of its memory mappings.
+             */
+            inline ~uring_t() noexcept
+            {
+                if (m_sqes != nullptr) ::munmap(m_sqes, m_sqes_size);
+                if (m_cq_ptr != nullptr && m_cq_ptr != m_sq_ptr) ::munmap(m_cq_ptr, m_cq_size);
+                if (m_sq_ptr != nullptr) ::munmap(m_sq_ptr, m_sq_size);
+                if (m_fd >= 0) ::close(m_fd);
+            }
+
+            inline uring_t& operator=(const uring_t&) noexcept = delete;
+            inline uring_t& operator=(uring_t&&) noexcept = delete;
+
+            /**
+             * Sets up the ring and maps its queues into memory.
+             * @param entries The minimum number of submission queue entries.
+             * @return Was the ring successfully set up by the kernel?
+             */
+            inline bool setup(unsigned entries) noexcept
+            {
+                struct io_uring_params params;
+                std::memset(&params, 0, sizeof(params));
+
+                m_fd = (int) ::syscall(__NR_io_uring_setup, entries, &params);
+                if (m_fd < 0) return false;
+
+                m_sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                m_cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+                if (params.features & IORING_FEAT_SINGLE_MMAP)
+                    m_sq_size = m_cq_size = std::max(m_sq_size, m_cq_size);
+
+                m_sq_ptr = map(m_sq_size, IORING_OFF_SQ_RING);
+                if (m_sq_ptr == nullptr) return false;
+
+                m_cq_ptr = (params.features & IORING_FEAT_SINGLE_MMAP)
+                    ? m_sq_ptr : map(m_cq_size, IORING_OFF_CQ_RING);
+                if (m_cq_ptr == nullptr) return false;
+
+                m_sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+                m_sqes = static_cast<struct io_uring_sqe*>(map(m_sqes_size, IORING_OFF_SQES));
+                if (m_sqes == nullptr) return false;
+
+                auto sq = static_cast<char*>(m_sq_ptr);
+                auto cq = static_cast<char*>(m_cq_ptr);
+
+                m_sq_head    = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+                m_sq_tail    = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+                m_sq_mask    = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+                m_sq_entries = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+                m_sq_array   = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+                m_cq_head    = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+                m_cq_tail    = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+                m_cq_mask    = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+                m_cqes       = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+                m_local_tail = *m_sq_tail;
+                return true;
+            }
+
+            /**
+             * Acquires a cleared submission queue entry to be filled in.
+             * @return The submission entry, or null if the queue is full.
+             */
+            inline struct io_uring_sqe *acquire() noexcept
+            {
+                const unsigned head = __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE);
+                if (m_local_tail - head >= *m_sq_entries) return nullptr;
+
+                const unsigned index = m_local_tail++ & *m_sq_mask;
+                m_sq_array[index] = index;
+                ++m_unsubmitted;
+
+                std::memset(&m_sqes[index], 0, sizeof(struct io_uring_sqe));
+                return &m_sqes[index];
+            }
+
+            /**
+             * Publishes all acquired entries to the kernel and possibly waits for
+             * some completions to be available.
+             * @param wait The minimum number of completions to wait for.
+             * @return Zero on success or the negated error number.
+             */
+            inline int enter(unsigned wait) noexcept
+            {
+                __atomic_store_n(m_sq_tail, m_local_tail, __ATOMIC_RELEASE);
+
+                for (;;) {
+                    const unsigned flags = wait > 0 ? IORING_ENTER_GETEVENTS : 0;
+                    const long r = ::syscall(__NR_io_uring_enter, m_fd, m_unsubmitted, wait, flags, nullptr, 0);
+
+                    if (r >= 0) { m_unsubmitted -= (unsigned) r; return 0; }
+                    if (errno != EINTR) return -errno;
+                }
+            }
+
+            /**
+             * Withdraws all acquired entries which have not been taken by the kernel
+             * yet, so that they are never submitted.
+             * @tparam F The handler type.
+             * @param lambda The handler to be invoked with each withdrawn entry's data.
+             */
+            template <typename F>
+            inline void discard(F&& lambda)
+            {
+                const unsigned first = m_local_tail - m_unsubmitted;
+
+                for (unsigned i = first; i != m_local_tail; ++i)
+                    lambda(m_sqes[m_sq_array[i & *m_sq_mask]].user_data);
+
+                m_local_tail = first;
+                m_unsubmitted = 0;
+                __atomic_store_n(m_sq_tail, m_local_tail, __ATOMIC_RELEASE);
+            }
+
+            /**
+             * Consumes all available completion entries.
+             * @tparam F The completion handler type.
+             * @param lambda The handler to be invoked with each completion.
+             */
+            template <typename F>
+            inline void reap(F&& lambda)
+            {
+                unsigned head = *m_cq_head;
+                const unsigned tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+
+                for (; head != tail; ++head) {
+                    const struct io_uring_cqe& cqe = m_cqes[head & *m_cq_mask];
+                    lambda(cqe.user_data, cqe.res);
+                }
+
+                __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+            }
+
+        private:
+            /**
+             * Maps one of the ring's regions into memory.
+             * @param size The size of the region to be mapped.
+             * @param offset The region's magic offset.
+             * @return The mapped region, or null on failure.
+             */
+            inline void *map(size_t size, off_t offset) noexcept
+            {
+                void *ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, offset);
+                return ptr == MAP_FAILED ? nullptr : ptr;
+            }
+    };
+  #endif
+}
+
+namespace io
+{
+    /**
+     * An append-only sink of serialized tuple batches, which moves all writes and
+     * syncs to a background worker so callers never stall on the file system.
+     * When the kernel supports it, the worker submits requests through io_uring,
+     * otherwise it falls back to plain positional writes. The total amount of
+     * memory held by queued buffers is bounded, so producers faster than the disk
+     * are eventually blocked instead of growing the queue indefinitely.
+     * @since 1.0
+     */
+    class async_sink_t
+    {
+        public:
+            typedef detail::sink_request_t::callback_t callback_t;
+
+        private:
+            typedef detail::sink_request_t request_t;
+
+        private:
+            int m_fd = -1;
+            bool m_owned = false;
+            sink_options_t m_options;
+
+            std::mutex m_mutex;
+            std::condition_variable m_submitted;
+            std::condition_variable m_released;
+            std::deque<request_t*> m_pending;
+
+            size_t m_offset = 0;
+            size_t m_inflight_bytes = 0;
+            size_t m_outstanding = 0;
+            bool m_stop = false;
+
+          #if defined(SUPERTUPLE_IO_URING_ENABLED)
+            std::unique_ptr<detail::uring_t> m_ring;
+          #endif
+            std::vector<request_t*> m_retry;
+            size_t m_inring = 0;
+
+            std::thread m_worker;
+
+        public:
+            inline async_sink_t() noexcept = delete;
+            inline async_sink_t(const async_sink_t&) noexcept = delete;
+            inline async_sink_t(async_sink_t&&) noexcept = delete;
+
+            /**
+             * Opens a file as the sink's target.
+             * @param path The path of the file to write records to.
+             * @param options The sink's configuration options.
+             */
+            inline explicit async_sink_t(const char *path, const sink_options_t& options = {})
+              : m_owned (true)
+              , m_options (options)
+            {
+                const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (options.truncate ? O_TRUNC : 0);
+
+                if ((m_fd = ::open(path, flags, 0644)) < 0)
+                    throw std::system_error(errno, std::generic_category(), "cannot open sink file");
+
+                if (!options.truncate) {
+                    const off_t end = ::lseek(m_fd, 0, SEEK_END);
+
+                    if (end < 0) {
+                        const int error = errno;
+                        ::close(m_fd);
+                        throw std::system_error(error, std::generic_category(), "cannot seek sink file");
+                    }
+
+                    m_offset = (size_t) end;
+                }
+
+                start();
+            }
+
+            /**
+             * Wraps an already open file descriptor as the sink's target. The descriptor
+             * is not owned by the sink and therefore is not closed by it.
+             * @param fd The file descriptor to write records to.
+             * @param offset The file offset where records must start being written at.
+             * @param options The sink's configuration options.
+             */
+            inline async_sink_t(int fd, size_t offset, const sink_options_t& options = {})
+              : m_fd (fd)
+              , m_options (options)
+              , m_offset (offset)
+            {
+                start();
+            }
+
+            /**
+             * Waits for all queued operations to complete and stops the worker.
+             */
+            inline ~async_sink_t()
+            {
+                {
+                    std::lock_guard lock (m_mutex);
+                    m_stop = true;
+                }
+
+                m_submitted.notify_all();
+                m_worker.join();
+
+                if (m_owned) ::close(m_fd);
+            }
+
+            inline async_sink_t& operator=(const async_sink_t&) noexcept = delete;
+            inline async_sink_t& operator=(async_sink_t&&) noexcept = delete;
+
+            /**
+             * Queues a raw buffer to be appended to the file. If the in-flight memory
+             * bound has been reached, the caller is blocked until enough of it is
+             * released by completed writes. The callback is invoked from the sink's
+             * worker thread and must not wait on the sink itself.
+             * @param buffer The buffer to be written.
+             * @param callback The function to be invoked when the write completes.
+             * @return The file offset the buffer will be written at.
+             */
+            inline size_t write(std::vector<std::byte>&& buffer, callback_t callback = {})
+            {
+                auto request = new request_t;
+                request->buffer = std::move(buffer);
+                request->callback = std::move(callback);
+
+                const size_t size = request->buffer.size();
+
+                std::unique_lock lock (m_mutex);
+                m_released.wait(lock, [&]() {
+                    return m_inflight_bytes == 0
+                        || m_inflight_bytes + size <= m_options.max_inflight_bytes; });
+
+                const size_t offset = m_offset;
+
+                request->offset = offset;
+                m_offset += size;
+                m_inflight_bytes += size;
+
+                enqueue(request);
+                return offset;
+            }
+
+            /**
+             * Serializes and queues a batch of tuples to be appended to the file.
+             * @tparam T The type of tuples in the batch.
+             * @param first The pointer to the batch's first tuple.
+             * @param count The number of tuples in the batch.
+             * @param callback The function to be invoked when the write completes.
+             * @return The file offset the batch will be written at.
+             */
+            template <typename T>
+            inline size_t write(const T *first, size_t count, callback_t callback = {})
+            {
+                std::vector<std::byte> buffer;
+                io::encode(buffer, first, count);
+                return write(std::move(buffer), std::move(callback));
+            }
+
+            /**
+             * Queues a synchronization of the file's data to the storage device. The
+             * sync is only started after all previously queued writes have completed.
+             * @param callback The function to be invoked when the sync completes.
+             */
+            inline void sync(callback_t callback = {})
+            {
+                auto request = new request_t;
+                request->sync = true;
+                request->callback = std::move(callback);
+
+                std::unique_lock lock (m_mutex);
+                enqueue(request);
+            }
+
+            /**
+             * Blocks the caller until all queued operations have been completed.
+             */
+            inline void flush()
+            {
+                std::unique_lock lock (m_mutex);
+                m_released.wait(lock, [&]() { return m_outstanding == 0; });
+            }
+
+            /**
+             * Informs the file size once all currently queued writes are completed.
+             * @return The offset at which the next write will be placed.
+             */
+            inline size_t size()
+            {
+                std::lock_guard lock (m_mutex);
+                return m_offset;
+            }
+
+            /**
+             * Informs whether the sink is backed by io_uring or by the fallback.
+             * @return Are requests being submitted through io_uring?
+             */
+            inline bool uring() const noexcept
+            {
+              #if defined(SUPERTUPLE_IO_URING_ENABLED)
+                return m_ring != nullptr;
+              #else
+                return false;
+              #endif
+            }
+
+        private:
+            /**
+             * Chooses the sink's backend and starts its worker thread.
+             */
+            inline void start()
+            {
+                if (m_options.queue_depth == 0)
+                    m_options.queue_depth = 1;
+
+              #if defined(SUPERTUPLE_IO_URING_ENABLED)
+                if (m_options.allow_uring) {
+                    m_ring = std::make_unique<detail::uring_t>();
+                    if (!m_ring->setup(m_options.queue_depth)) m_ring.reset();
+                }
+              #endif
+
+                m_worker = std::thread([this]() { run(); });
+            }
+
+            /**
+             * Pushes a request to the worker's queue. The caller must hold the lock.
+             * @param request The request to be queued.
+             */
+            inline void enqueue(request_t *request)
+            {
+                m_pending.push_back(request);
+                ++m_outstanding;
+                m_submitted.notify_one();
+            }
+
+            /**
+             * Finishes a request, invoking its callback and releasing its memory.
+             * @param request The request to be finished.
+             * @param error The error the request finished with, if any.
+             */
+            inline void complete(request_t *request, int error)
+            {
+                const size_t size = request->buffer.size();
+
+                if (request->callback)
+                    request->callback(std::error_code(error, std::generic_category()), error ? request->done : size);
+
+                {
+                    std::lock_guard lock (m_mutex);
+                    m_inflight_bytes -= size;
+                    --m_outstanding;
+                }
+
+                m_released.notify_all();
+                delete request;
+            }
+
+            /**
+             * The worker's main loop, which drains the queue into the backend until
+             * the sink is destroyed and nothing else remains to be done.
+             */
+            inline void run()
+            {
+                std::vector<request_t*> batch;
+                std::unique_lock lock (m_mutex);
+
+                for (;;) {
+                    m_submitted.wait(lock, [&]() {
+                        return m_stop || !m_pending.empty() || busy(); });
+
+                    if (m_stop && m_pending.empty() && !busy())
+                        break;
+
+                    take(batch);
+                    lock.unlock();
+
+                  #if defined(SUPERTUPLE_IO_URING_ENABLED)
+                    if (m_ring) process_uring(batch);
+                    else process_sync(batch);
+                  #else
+                    process_sync(batch);
+                  #endif
+
+                    batch.clear();
+                    lock.lock();
+                }
+            }
+
+            /**
+             * Informs whether there are requests still owned by the backend.
+             * @return Are there requests being processed by the backend?
+             */
+            inline bool busy() const noexcept
+            {
+                return m_inring > 0 || !m_retry.empty();
+            }
+
+            /**
+             * Takes as many ready requests from the queue as the backend can accept.
+             * A sync request acts as a barrier, so it is only taken when no writes are
+             * still being processed, and no other request is taken along with it.
+             * @param batch The list to take the requests into.
+             */
+            inline void take(std::vector<request_t*>& batch)
+            {
+                const bool uring = this->uring();
+
+                while (!m_pending.empty()) {
+                    request_t *request = m_pending.front();
+
+                    if (uring) {
+                        if (m_inring + m_retry.size() + batch.size() >= m_options.queue_depth) break;
+                        if (request->sync && (busy() || !batch.empty())) break;
+                    }
+
+                    m_pending.pop_front();
+                    batch.push_back(request);
+
+                    if (uring && request->sync) break;
+                }
+            }
+
+            /**
+             * Processes a batch of requests synchronously, with positional writes.
+             * @param batch The requests to be processed.
+             */
+            inline void process_sync(const std::vector<request_t*>& batch)
+            {
+                for (request_t *request : batch) {
+                    int error = 0;
+
+                    if (request->sync) {
+                        int r;
+                        while ((r = ::fdatasync(m_fd)) < 0 && errno == EINTR);
+                        error = r < 0 ? errno : 0;
+                    } else {
+                        while (request->done < request->buffer.size()) {
+                            const ssize_t r = ::pwrite(
+                                m_fd, request->buffer.data() + request->done
+                              , request->buffer.size() - request->done
+                              , (off_t) (request->offset + request->done));
+
+                            if (r < 0 && errno == EINTR) continue;
+                            if (r <= 0) { error = r < 0 ? errno : EIO; break; }
+                            request->done += (size_t) r;
+                        }
+                    }
+
+                    complete(request, error);
+                }
+            }
+
+          #if defined(SUPERTUPLE_IO_URING_ENABLED)
+            /**
+             * Submits a batch of requests to the ring and reaps available completions.
+             * If there is nothing new to submit, waits for at least one completion.
+             * Transient submission failures, such as a full completion queue, are
+             * simply retried on the next round, after completions have been reaped.
+             * Any other failure is persistent, and the ring is abandoned for good.
+             * @param batch The requests to be submitted.
+             */
+            inline void process_uring(const std::vector<request_t*>& batch)
+            {
+                std::vector<request_t*> submit;
+                submit.swap(m_retry);
+                submit.insert(submit.end(), batch.begin(), batch.end());
+
+                for (request_t *request : submit)
+                    prepare(request);
+
+                const int error = m_ring->enter(submit.empty() && m_inring > 0 ? 1 : 0);
+                m_ring->reap([&](uint64_t data, int result) { reaped(data, result); });
+
+                if (error != 0 && error != -EAGAIN && error != -EBUSY)
+                    abandon();
+            }
+
+            /**
+             * Handles the completion of a request submitted to the ring. Short writes
+             * are queued to be resubmitted with the request's remaining bytes.
+             * @param data The completed request's pointer.
+             * @param result The number of bytes written or the negated error number.
+             */
+            inline void reaped(uint64_t data, int result)
+            {
+                auto request = reinterpret_cast<request_t*>(data);
+                --m_inring;
+
+                if (result < 0)
+                    return complete(request, -result);
+
+                if (!request->sync) {
+                    request->done += (size_t) result;
+                    if (result == 0) return complete(request, EIO);
+                    if (request->done < request->buffer.size()) return m_retry.push_back(request);
+                }
+
+                complete(request, 0);
+            }
+
+            /**
+             * Stops using the ring after a persistent submission failure. Requests not
+             * taken by the kernel are withdrawn, the ones already in flight are waited
+             * for, and then all of them, as well as later ones, are processed by the
+             * synchronous fallback instead.
+             */
+            inline void abandon()
+            {
+                std::vector<request_t*> rejected;
+
+                m_ring->discard([&](uint64_t data) {
+                    rejected.push_back(reinterpret_cast<request_t*>(data));
+                    --m_inring;
+                });
+
+                while (m_inring > 0) {
+                    if (m_ring->enter(1) != 0) std::this_thread::yield();
+                    m_ring->reap([&](uint64_t data, int result) { reaped(data, result); });
+                }
+
+                rejected.insert(rejected.end(), m_retry.begin(), m_retry.end());
+                m_retry.clear();
+
+                m_ring.reset();
+                process_sync(rejected);
+            }
+
+            /**
+             * Fills in a submission entry for the given request.
+             * @param request The request to be submitted.
+             */
+            inline void prepare(request_t *request) noexcept
+            {
+                struct io_uring_sqe *sqe = m_ring->acquire();
+
+                if (request->sync) {
+                    sqe->opcode = IORING_OP_FSYNC;
+                    sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+                } else {
+                    request->iov.iov_base = request->buffer.data() + request->done;
+                    request->iov.iov_len = request->buffer.size() - request->done;
+                    sqe->opcode = IORING_OP_WRITEV;
+                    sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+                    sqe->len = 1;
+                    sqe->off = request->offset + request->done;
+                }
+
+                sqe->fd = m_fd;
+                sqe->user_data = reinterpret_cast<uint64_t>(request);
+                ++m_inring;
+            }
+
+          #endif
+    };
+}
+
+SUPERTUPLE_END_NAMESPACE
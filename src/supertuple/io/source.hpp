@@ -0,0 +1,168 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The buffered tuple record source implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <supertuple/environment.h>
+#include <supertuple/io/serialize.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace io
+{
+    /**
+     * Reads a contiguous range of bytes from a file at the given offset, retrying
+     * on interruptions and short reads until the whole range has been read.
+     * @param fd The file descriptor to read from.
+     * @param data The buffer to read the bytes into.
+     * @param size The number of bytes to be read.
+     * @param offset The file offset to start reading at.
+     * @return The number of bytes read, which is only short at the end of file.
+     */
+    inline size_t read_at(int fd, std::byte *data, size_t size, size_t offset)
+    {
+        size_t done = 0;
+
+        while (done < size) {
+            const ssize_t r = ::pread(fd, data + done, size - done, (off_t) (offset + done));
+            if (r < 0 && errno == EINTR) continue;
+            if (r < 0) throw std::system_error(errno, std::generic_category(), "cannot read from file");
+            if (r == 0) break;
+            done += (size_t) r;
+        }
+
+        return done;
+    }
+
+    /**
+     * Writes a contiguous range of bytes to a file at the given offset, retrying on
+     * interruptions and short writes until the whole range has been written.
+     * @param fd The file descriptor to write to.
+     * @param data The bytes to be written.
+     * @param size The number of bytes to be written.
+     * @param offset The file offset to start writing at.
+     */
+    inline void write_at(int fd, const std::byte *data, size_t size, size_t offset)
+    {
+        for (size_t done = 0; done < size; ) {
+            const ssize_t r = ::pwrite(fd, data + done, size - done, (off_t) (offset + done));
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) throw std::system_error(r < 0 ? errno : EIO, std::generic_category(), "cannot write to file");
+            done += (size_t) r;
+        }
+    }
+
+    /**
+     * A sequential reader of tuple records from a file in the compact binary format,
+     * such as the ones written by an asynchronous sink. Records are read in blocks
+     * and decoded into the caller's memory.
+     * @tparam T The type of records in the file.
+     * @since 1.0
+     */
+    template <typename T>
+    class source_t
+    {
+        public:
+            typedef T value_t;
+
+        private:
+            int m_fd = -1;
+            bool m_owned = false;
+            size_t m_offset = 0;
+            std::vector<std::byte> m_buffer;
+
+        public:
+            inline source_t() noexcept = delete;
+            inline source_t(const source_t&) noexcept = delete;
+
+            /**
+             * Opens a file as the source's origin.
+             * @param path The path of the file to read records from.
+             * @param block The number of records to be read at once.
+             */
+            inline explicit source_t(const char *path, size_t block = 4096)
+              : m_owned (true)
+              , m_buffer (std::max<size_t>(1, block) * record_size_v<T>)
+            {
+                if ((m_fd = ::open(path, O_RDONLY | O_CLOEXEC)) < 0)
+                    throw std::system_error(errno, std::generic_category(), "cannot open source file");
+            }
+
+            /**
+             * Wraps an already open file descriptor as the source's origin. The descriptor
+             * is not owned by the source and therefore is not closed by it.
+             * @param fd The file descriptor to read records from.
+             * @param offset The file offset where records start at.
+             * @param block The number of records to be read at once.
+             */
+            inline source_t(int fd, size_t offset, size_t block = 4096)
+              : m_fd (fd)
+              , m_offset (offset)
+              , m_buffer (std::max<size_t>(1, block) * record_size_v<T>)
+            {}
+
+            /**
+             * Moves a source and its file ownership into a new instance.
+             * @param other The source to be moved.
+             */
+            inline source_t(source_t&& other) noexcept
+              : m_fd (std::exchange(other.m_fd, -1))
+              , m_owned (std::exchange(other.m_owned, false))
+              , m_offset (other.m_offset)
+              , m_buffer (std::move(other.m_buffer))
+            {}
+
+            /**
+             * Closes the file, if it is owned by the source.
+             */
+            inline ~source_t()
+            {
+                if (m_owned) ::close(m_fd);
+            }
+
+            inline source_t& operator=(const source_t&) noexcept = delete;
+            inline source_t& operator=(source_t&&) noexcept = delete;
+
+            /**
+             * Reads and decodes the next records from the file. A partial record at
+             * the end of the file is ignored.
+             * @param out The pointer to where the decoded records must be written to.
+             * @param count The maximum number of records to be read.
+             * @return The number of records read, which is zero at the end of file.
+             */
+            inline size_t read(T *out, size_t count)
+            {
+                constexpr size_t size = record_size_v<T>;
+                const size_t block = m_buffer.size() / size;
+                size_t total = 0;
+
+                while (total < count) {
+                    const size_t bytes = std::min(count - total, block) * size;
+                    const size_t n = io::read_at(m_fd, m_buffer.data(), bytes, m_offset) / size;
+
+                    io::decode(m_buffer.data(), out + total, n);
+                    m_offset += n * size;
+                    total += n;
+
+                    if (n * size < bytes) break;
+                }
+
+                return total;
+            }
+    };
+}
+
+SUPERTUPLE_END_NAMESPACE
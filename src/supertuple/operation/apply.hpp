@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include <supertuple/environment.h>
@@ -69,6 +70,29 @@ inline namespace operation
             )...
         );
     }
+
+    /**
+     * Applies a functor to all of a foreign tuple-like instance's elements, such as
+     * a standard tuple, pair or array, without converting it beforehand.
+     * @tparam T The foreign tuple-like type.
+     * @tparam F The functor type to apply.
+     * @tparam A The types of extra arguments.
+     * @param t The foreign tuple-like instance to apply functor to.
+     * @param lambda The functor to apply to the tuple.
+     * @param args The remaining functor arguments.
+     * @return The new transformed tuple.
+     */
+    template <
+        typename T, typename F, typename ...A
+      , typename = std::enable_if_t<detail::foreign_v<std::decay_t<T>>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) apply(T&& t, F&& lambda, A&&... args)
+    {
+        return operation::apply(
+            detail::view(std::forward<decltype(t)>(t), std::make_index_sequence<std::tuple_size_v<std::decay_t<T>>>())
+          , std::forward<decltype(lambda)>(lambda)
+          , std::forward<decltype(args)>(args)...
+        );
+    }
 }
 
 SUPERTUPLE_END_NAMESPACE
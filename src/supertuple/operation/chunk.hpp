@@ -0,0 +1,85 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The n-tuple chunk operation implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/operation/split.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Slices a n-tuple into chunks of the given length.
+     * @tparam K The chunks' length.
+     * @tparam T The n-tuple's possibly const-qualified type.
+     * @tparam I The chunks' sequence indeces.
+     * @param t The n-tuple to be chunked.
+     * @return The tuple of chunks followed by the remainder.
+     */
+    template <size_t K, typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto chunk(T& t, std::index_sequence<I...>) noexcept
+    {
+        constexpr size_t N = std::remove_const_t<T>::count;
+        return tuple_t(
+            detail::slice<I * K, K>(t)...
+          , detail::slice<N / K * K, N % K>(t)
+        );
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Slices a n-tuple into chunks of the given length, without copying its elements.
+     * Each chunk is a n-tuple of references to the original elements, and the last
+     * element is the remainder, with the elements that do not fill a whole chunk.
+     * As the remainder has a distinct type, a functor iterating over the chunks can
+     * dispatch whole chunks to a fixed-width kernel at compile-time.
+     * @tparam K The chunks' length.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to be chunked.
+     * @return The tuple of chunks followed by the possibly empty remainder.
+     */
+    template <size_t K, typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR decltype(auto) chunk(ntuple_t<T, N>& t) noexcept
+    {
+        static_assert(K > 0, "chunks must not be empty");
+        return detail::chunk<K>(t, std::make_index_sequence<N / K>());
+    }
+
+    /**
+     * Slices a const-qualified n-tuple into chunks of the given length, without copying
+     * its elements. Each chunk is a n-tuple of const-qualified references to the
+     * original elements, and the last element is the remainder.
+     * @tparam K The chunks' length.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to be chunked.
+     * @return The tuple of chunks followed by the possibly empty remainder.
+     */
+    template <size_t K, typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR decltype(auto) chunk(const ntuple_t<T, N>& t) noexcept
+    {
+        static_assert(K > 0, "chunks must not be empty");
+        return detail::chunk<K>(t, std::make_index_sequence<N / K>());
+    }
+
+    /**
+     * Chunks of a moving n-tuple would reference elements about to be destroyed.
+     * @since 1.0
+     */
+    template <size_t K, typename T, size_t N>
+    void chunk(ntuple_t<T, N>&&) = delete;
+}
+
+SUPERTUPLE_END_NAMESPACE
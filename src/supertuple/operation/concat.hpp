@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include <supertuple/environment.h>
@@ -16,6 +17,33 @@
 
 SUPERTUPLE_BEGIN_NAMESPACE
 
+namespace detail
+{
+    /**
+     * Concatenates two tuple-like instances by forwarding their elements.
+     * @tparam T The first tuple-like type.
+     * @tparam U The second tuple-like type.
+     * @tparam I The first tuple-like type's sequence indeces.
+     * @tparam J The second tuple-like type's sequence indeces.
+     * @param a The first tuple-like instance to concatenate.
+     * @param b The second tuple-like instance to concatenate.
+     * @return The resulting concatenated tuple.
+     */
+    template <typename T, typename U, size_t ...I, size_t ...J>
+    SUPERTUPLE_CONSTEXPR decltype(auto) concat(
+        T&& a, U&& b
+      , std::index_sequence<I...>, std::index_sequence<J...>
+    ) {
+        return tuple_t<
+            std::tuple_element_t<I, std::decay_t<T>>...
+          , std::tuple_element_t<J, std::decay_t<U>>...
+        >(
+            detail::unpack<I>(std::forward<decltype(a)>(a))...
+          , detail::unpack<J>(std::forward<decltype(b)>(b))...
+        );
+    }
+}
+
 inline namespace operation
 {
     /**
@@ -59,6 +87,30 @@ inline namespace operation
           , operation::get<J>(std::forward<decltype(b)>(b))...
         );
     }
+
+    /**
+     * Concatenates two tuple-like instances, of which at least one is foreign, such
+     * as a standard tuple, pair or array. The elements are forwarded directly into
+     * the resulting tuple, without converting the foreign instances beforehand.
+     * @tparam T The first tuple-like type.
+     * @tparam U The second tuple-like type.
+     * @param a The first tuple-like instance to concatenate.
+     * @param b The second tuple-like instance to concatenate.
+     * @return The resulting concatenated tuple.
+     */
+    template <
+        typename T, typename U
+      , typename = std::enable_if_t<
+            detail::foreign_v<std::decay_t<T>> ||
+            detail::foreign_v<std::decay_t<U>>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) concat(T&& a, U&& b)
+    {
+        return detail::concat(
+            std::forward<decltype(a)>(a), std::forward<decltype(b)>(b)
+          , std::make_index_sequence<std::tuple_size_v<std::decay_t<T>>>()
+          , std::make_index_sequence<std::tuple_size_v<std::decay_t<U>>>()
+        );
+    }
 }
 
 SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,149 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The n-tuple find operation implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Lays out the elements of an n-tuple contiguously, so that they can be processed
+     * by data-parallel kernels. Arithmetic elements are copied, which compilers turn
+     * into plain block moves, while other elements are only pointed to.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @tparam I The n-tuple's sequence indeces.
+     * @param t The n-tuple to be laid out.
+     * @return The array of the n-tuple's elements or pointers to them.
+     */
+    template <typename T, size_t N, size_t ...I>
+    inline auto contiguous(const ntuple_t<T, N>& t, std::index_sequence<I...>) noexcept
+    {
+        if constexpr (std::is_arithmetic_v<T>) {
+            return std::array<T, N> {operation::get<I>(t)...};
+        } else {
+            return std::array<const T*, N> {&operation::get<I>(t)...};
+        }
+    }
+
+    /**
+     * Compares two arithmetic values by their mathematical values. Unlike the usual
+     * arithmetic conversions, a negative value never equals an unsigned one.
+     * @tparam T The first value's type.
+     * @tparam U The second value's type.
+     * @param a The first value to be compared.
+     * @param b The second value to be compared.
+     * @return Are both values equal?
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR bool equal(const T& a, const U& b) noexcept
+    {
+        if constexpr (std::is_integral_v<T> && std::is_integral_v<U> && std::is_signed_v<T> != std::is_signed_v<U>) {
+            using unsigned_t = std::make_unsigned_t<std::common_type_t<T, U>>;
+            return !(a < T()) && !(b < U()) && (unsigned_t) a == (unsigned_t) b;
+        } else {
+            return a == b;
+        }
+    }
+
+    /**
+     * Checks whether an arithmetic value lies within the range of another arithmetic
+     * type, so that converting it to that type is well-defined. Floating-point values
+     * are only converted to integers if they are not NaN and do not overflow, and
+     * to narrower floating-point types if they are not finite or do not overflow.
+     * @tparam T The type to convert the value to.
+     * @tparam U The value's type.
+     * @param value The value to be checked.
+     * @return Can the value be converted to the type?
+     */
+    template <typename T, typename U>
+    inline bool convertible(const U& value) noexcept
+    {
+        using limits_t = std::numeric_limits<T>;
+
+        if constexpr (std::is_floating_point_v<U> && std::is_integral_v<T>) {
+            return !std::isnan(value)
+                && value >= static_cast<U>(limits_t::lowest())
+                && value < std::ldexp(U(1), limits_t::digits);
+        } else if constexpr (std::is_floating_point_v<U> && std::is_floating_point_v<T>) {
+            return !std::isfinite(value) || std::fabs(value) <= static_cast<U>(limits_t::max());
+        } else {
+            return true;
+        }
+    }
+
+    /**
+     * Checks whether a value is exactly represented after a conversion to another
+     * arithmetic type, so that comparisons in either type agree.
+     * @tparam T The converted value's type.
+     * @tparam U The original value's type.
+     * @param converted The value after the conversion.
+     * @param value The value before the conversion.
+     * @return Has the value survived the conversion unchanged?
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR bool exact(const T& converted, const U& value) noexcept
+    {
+        return static_cast<U>(converted) == value && (converted < T()) == (value < U());
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Finds the first element of an n-tuple that is equal to the given value.
+     * Arithmetic n-tuples are searched with vector compares, unless the value is
+     * not exactly representable by the elements' type, in which case elements are
+     * compared to the value one by one, without narrowing it.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @tparam U The searched value's type.
+     * @param t The n-tuple to be searched.
+     * @param value The value to be found.
+     * @return The index of the first matching element, or the n-tuple's size.
+     */
+    template <typename T, size_t N, typename U>
+    inline size_t find(const ntuple_t<T, N>& t, const U& value)
+    {
+        const auto data = detail::contiguous(t, std::make_index_sequence<N>());
+
+        if constexpr (std::is_arithmetic_v<T>) {
+            if constexpr (std::is_same_v<T, U>) {
+                return detail::simd::find(data.data(), N, value);
+            } else if constexpr (std::is_arithmetic_v<U>) {
+                if (detail::convertible<T>(value)) {
+                    const T needle = static_cast<T>(value);
+                    if (detail::exact(needle, value))
+                        return detail::simd::find(data.data(), N, needle);
+                }
+            }
+
+            for (size_t i = 0; i < N; ++i)
+                if (detail::equal(data[i], value)) return i;
+            return N;
+        } else {
+            for (size_t i = 0; i < N; ++i)
+                if (*data[i] == value) return i;
+            return N;
+        }
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
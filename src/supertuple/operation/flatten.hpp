@@ -0,0 +1,167 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The tuple flatten operation implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/concat.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Concatenates the types of a list of tuples.
+     * @tparam T The tuples to have their types concatenated.
+     * @since 1.0
+     */
+    template <typename ...T>
+    struct cat_t { using type = tuple_t<>; };
+
+    template <typename ...T>
+    struct cat_t<tuple_t<T...>> { using type = tuple_t<T...>; };
+
+    template <typename ...T, typename ...U, typename ...R>
+    struct cat_t<tuple_t<T...>, tuple_t<U...>, R...> : cat_t<tuple_t<T..., U...>, R...> {};
+
+    /**
+     * Computes the flat list of types of a possibly nested tuple element.
+     * @tparam T The element type to be flattened.
+     * @since 1.0
+     */
+    template <typename T, typename = void>
+    struct flat_t { using type = tuple_t<T>; };
+
+    template <typename T>
+    struct unnest_t;
+
+    template <typename ...T>
+    struct unnest_t<tuple_t<T...>> : cat_t<typename flat_t<T>::type...> {};
+
+    template <typename T>
+    struct flat_t<T, std::enable_if_t<native_t<T>::value>> : unnest_t<typename T::base_tuple_t> {};
+
+    /**
+     * Concatenates a list of tuples of references.
+     * @return The concatenated tuple of references.
+     */
+    SUPERTUPLE_CONSTEXPR auto cat() noexcept
+    {
+        return tuple_t<>();
+    }
+
+    /**
+     * Concatenates a list of tuples of references.
+     * @tparam T The single tuple's type.
+     * @param t The single tuple to be concatenated.
+     * @return The concatenated tuple of references.
+     */
+    template <typename T>
+    SUPERTUPLE_CONSTEXPR auto cat(T&& t) noexcept
+    {
+        return std::forward<decltype(t)>(t);
+    }
+
+    /**
+     * Concatenates a list of tuples of references.
+     * @tparam T The first tuple's type.
+     * @tparam U The second tuple's type.
+     * @tparam R The remaining tuples' types.
+     * @param a The first tuple to be concatenated.
+     * @param b The second tuple to be concatenated.
+     * @param r The remaining tuples to be concatenated.
+     * @return The concatenated tuple of references.
+     */
+    template <typename T, typename U, typename ...R>
+    SUPERTUPLE_CONSTEXPR auto cat(T&& a, U&& b, R&&... r) noexcept
+    {
+        return cat(
+            operation::concat(std::forward<decltype(a)>(a), std::forward<decltype(b)>(b))
+          , std::forward<decltype(r)>(r)...);
+    }
+
+    /**
+     * Gathers forwarding references to all leaves of a possibly nested element.
+     * @tparam E The element's declared type.
+     * @tparam T The element's forwarded type.
+     * @param value The element to gather the leaves of.
+     * @return The tuple of references to the element's leaves.
+     */
+    template <typename E, typename T>
+    SUPERTUPLE_CONSTEXPR auto unnest(T&& value) noexcept;
+
+    /**
+     * Gathers forwarding references to all leaves of a nested tuple.
+     * @tparam E The nested tuple's declared type.
+     * @tparam T The nested tuple's forwarded type.
+     * @tparam I The nested tuple's sequence indeces.
+     * @param t The nested tuple to gather the leaves of.
+     * @return The tuple of references to the tuple's leaves.
+     */
+    template <typename E, typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto unnest(T&& t, std::index_sequence<I...>) noexcept
+    {
+        return detail::cat(detail::unnest<tuple_element_t<E, I>>(
+            operation::get<I>(std::forward<decltype(t)>(t)))...);
+    }
+
+    template <typename E, typename T>
+    SUPERTUPLE_CONSTEXPR auto unnest(T&& value) noexcept
+    {
+        if constexpr (!native_t<E>::value) {
+            return tuple_t<T&&>(std::forward<decltype(value)>(value));
+        } else {
+            return detail::unnest<E>(std::forward<decltype(value)>(value), std::make_index_sequence<E::count>());
+        }
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Flattens a tuple of nested tuples, at any depth, into a tuple of its leaves.
+     * References to all leaves are gathered first, so the flat tuple is built in
+     * a single construction, copying each leaf exactly once. Elements that are
+     * references to tuples are not owned, and thus are kept as references.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be flattened.
+     * @return The resulting flat tuple.
+     */
+    template <size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) flatten(
+        const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) {
+        using flat_t = typename detail::flat_t<tuple_t<T...>>::type;
+        return flat_t(detail::unnest<tuple_t<T...>>(t));
+    }
+
+    /**
+     * Flattens a moving tuple of nested tuples, at any depth, into a tuple of its
+     * leaves. Move-references to all leaves are gathered first, so the flat tuple
+     * is built in a single construction, moving each leaf exactly once.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be flattened.
+     * @return The resulting flat tuple.
+     */
+    template <size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) flatten(
+        tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>&& t
+    ) {
+        using flat_t = typename detail::flat_t<tuple_t<T...>>::type;
+        return flat_t(detail::unnest<tuple_t<T...>>(std::forward<decltype(t)>(t)));
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include <supertuple/environment.h>
@@ -150,6 +151,51 @@ inline namespace operation
           , std::index_sequence<(J-I-1)...>()
         );
     }
+
+    /**
+     * Performs a left-fold reduction over a foreign tuple-like instance, such as a
+     * standard tuple, pair or array, without converting it beforehand.
+     * @tparam T The foreign tuple-like type.
+     * @tparam F The functor type to fold the tuple with.
+     * @tparam B The fold operation base type.
+     * @param t The foreign tuple-like instance to fold.
+     * @param lambda The functor used to fold the tuple with.
+     * @param base The folding base value.
+     * @return The fold resulting value.
+     */
+    template <
+        typename T, typename F, typename B
+      , typename = std::enable_if_t<detail::foreign_v<std::decay_t<T>>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) foldl(T&& t, F&& lambda, B&& base)
+    {
+        constexpr size_t N = std::tuple_size_v<std::decay_t<T>>;
+        return detail::fold(
+            detail::view(std::forward<decltype(t)>(t), std::make_index_sequence<N>())
+          , lambda, base
+          , std::make_index_sequence<N>()
+        );
+    }
+
+    /**
+     * Performs a left-fold reduction without base over a foreign tuple-like instance,
+     * such as a standard tuple, pair or array, without converting it beforehand.
+     * @tparam T The foreign tuple-like type.
+     * @tparam F The functor type to fold the tuple with.
+     * @param t The foreign tuple-like instance to fold.
+     * @param lambda The functor used to fold the tuple with.
+     * @return The fold resulting value.
+     */
+    template <
+        typename T, typename F
+      , typename = std::enable_if_t<detail::foreign_v<std::decay_t<T>>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) foldl(T&& t, F&& lambda)
+    {
+        constexpr size_t N = std::tuple_size_v<std::decay_t<T>>;
+        return operation::foldl(
+            detail::view(std::forward<decltype(t)>(t), std::make_index_sequence<N>())
+          , lambda
+        );
+    }
 }
 
 SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,118 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The tuple hash operation implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Mixes the bits of a 64-bit value, so that every input bit affects every output
+     * bit. This is needed as standard hashes of integers are usually the identity.
+     * @param x The value to be mixed.
+     * @return The mixed value.
+     */
+    SUPERTUPLE_CONSTEXPR uint64_t mix(uint64_t x) noexcept
+    {
+        x ^= x >> 33; x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33; x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    /**
+     * Hashes a single tuple element with the standard hash of its decayed type, so
+     * that references to a value hash equally to the value itself.
+     * @tparam T The element type to be hashed.
+     * @param value The element to be hashed.
+     * @return The element's hash value.
+     */
+    template <typename T>
+    inline uint64_t hash(const T& value)
+    {
+        return (uint64_t) std::hash<std::remove_cv_t<std::remove_reference_t<T>>>()(value);
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Computes the hash of a tuple by combining the hashes of all of its elements.
+     * As elements are hashed by their decayed types, a tuple of references, such as
+     * one created by `tie`, has the same hash as a tuple owning the same values.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be hashed.
+     * @return The tuple's hash value.
+     */
+    template <size_t ...I, typename ...T>
+    inline uint64_t hash(
+        const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) {
+        uint64_t seed = sizeof...(T);
+        ((seed = detail::mix(seed + 0x9e3779b97f4a7c15ULL + detail::hash(operation::get<I>(t)))), ...);
+        return seed;
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
+
+/**
+ * Allows generic tuples to be used as keys of standard hashed containers.
+ * @tparam T The tuple's elements' types.
+ * @since 1.0
+ */
+template <typename ...T>
+struct std::hash<SUPERTUPLE_NAMESPACE::tuple_t<T...>>
+{
+    inline size_t operator()(const SUPERTUPLE_NAMESPACE::tuple_t<T...>& t) const
+    {
+        return (size_t) SUPERTUPLE_NAMESPACE::operation::hash(t);
+    }
+};
+
+/**
+ * Allows n-tuples to be used as keys of standard hashed containers.
+ * @tparam T The n-tuple's elements' type.
+ * @tparam N The total number of elements in the n-tuple.
+ * @since 1.0
+ */
+template <typename T, size_t N>
+struct std::hash<SUPERTUPLE_NAMESPACE::ntuple_t<T, N>>
+{
+    inline size_t operator()(const SUPERTUPLE_NAMESPACE::ntuple_t<T, N>& t) const
+    {
+        return (size_t) SUPERTUPLE_NAMESPACE::operation::hash(t);
+    }
+};
+
+/**
+ * Allows pairs to be used as keys of standard hashed containers.
+ * @tparam T The pair's first element type.
+ * @tparam U The pair's second element type.
+ * @since 1.0
+ */
+template <typename T, typename U>
+struct std::hash<SUPERTUPLE_NAMESPACE::pair_t<T, U>>
+{
+    inline size_t operator()(const SUPERTUPLE_NAMESPACE::pair_t<T, U>& t) const
+    {
+        return (size_t) SUPERTUPLE_NAMESPACE::operation::hash(t);
+    }
+};
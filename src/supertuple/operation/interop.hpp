@@ -0,0 +1,201 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The conversions between tuples and their standard library counterparts.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Forwards the elements of a tuple-like instance into a new instance of another
+     * tuple-like type. Elements are moved when the source instance is moving.
+     * @tparam R The tuple-like type to be created.
+     * @tparam T The source tuple-like type.
+     * @tparam I The tuple-like types' sequence indeces.
+     * @param t The source tuple-like instance.
+     * @return The new tuple-like instance.
+     */
+    template <typename R, typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR R rebuild(T&& t, std::index_sequence<I...>)
+    {
+        return R {detail::unpack<I>(std::forward<decltype(t)>(t))...};
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Converts a tuple into a standard tuple.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be converted.
+     * @return The new standard tuple.
+     */
+    template <size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) to_std(
+        const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) {
+        return std::tuple<T...>(operation::get<I>(t)...);
+    }
+
+    /**
+     * Converts a moving tuple into a standard tuple, moving its elements.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be converted.
+     * @return The new standard tuple.
+     */
+    template <size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) to_std(
+        tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>&& t
+    ) {
+        return std::tuple<T...>(operation::get<I>(std::forward<decltype(t)>(t))...);
+    }
+
+    /**
+     * Converts a pair into a standard pair.
+     * @tparam T The pair's first element type.
+     * @tparam U The pair's second element type.
+     * @param p The pair to be converted.
+     * @return The new standard pair.
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR decltype(auto) to_std(const pair_t<T, U>& p)
+    {
+        return std::pair<T, U>(operation::get<0>(p), operation::get<1>(p));
+    }
+
+    /**
+     * Converts a moving pair into a standard pair, moving its elements.
+     * @tparam T The pair's first element type.
+     * @tparam U The pair's second element type.
+     * @param p The pair to be converted.
+     * @return The new standard pair.
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR decltype(auto) to_std(pair_t<T, U>&& p)
+    {
+        return std::pair<T, U>(
+            operation::get<0>(std::forward<decltype(p)>(p))
+          , operation::get<1>(std::forward<decltype(p)>(p)));
+    }
+
+    /**
+     * Converts a n-tuple of values into a standard array.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to be converted.
+     * @return The new standard array.
+     */
+    template <typename T, size_t N, typename = std::enable_if_t<!std::is_reference_v<T>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) to_std(const ntuple_t<T, N>& t)
+    {
+        return detail::rebuild<std::array<T, N>>(t, std::make_index_sequence<N>());
+    }
+
+    /**
+     * Converts a moving n-tuple of values into a standard array, moving its elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to be converted.
+     * @return The new standard array.
+     */
+    template <typename T, size_t N, typename = std::enable_if_t<!std::is_reference_v<T>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) to_std(ntuple_t<T, N>&& t)
+    {
+        return detail::rebuild<std::array<T, N>>(std::forward<decltype(t)>(t), std::make_index_sequence<N>());
+    }
+
+    /**
+     * Converts a standard tuple into a tuple.
+     * @tparam T The standard tuple's elements' types.
+     * @param t The standard tuple to be converted.
+     * @return The new tuple.
+     */
+    template <typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) from_std(const std::tuple<T...>& t)
+    {
+        return tuple_t<T...>(t);
+    }
+
+    /**
+     * Converts a moving standard tuple into a tuple, moving its elements.
+     * @tparam T The standard tuple's elements' types.
+     * @param t The standard tuple to be converted.
+     * @return The new tuple.
+     */
+    template <typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) from_std(std::tuple<T...>&& t)
+    {
+        return tuple_t<T...>(std::forward<decltype(t)>(t));
+    }
+
+    /**
+     * Converts a standard pair into a pair.
+     * @tparam T The standard pair's first element type.
+     * @tparam U The standard pair's second element type.
+     * @param p The standard pair to be converted.
+     * @return The new pair.
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR decltype(auto) from_std(const std::pair<T, U>& p)
+    {
+        return pair_t<T, U>(p);
+    }
+
+    /**
+     * Converts a moving standard pair into a pair, moving its elements.
+     * @tparam T The standard pair's first element type.
+     * @tparam U The standard pair's second element type.
+     * @param p The standard pair to be converted.
+     * @return The new pair.
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR decltype(auto) from_std(std::pair<T, U>&& p)
+    {
+        return pair_t<T, U>(std::forward<decltype(p)>(p));
+    }
+
+    /**
+     * Converts a standard array into a n-tuple.
+     * @tparam T The standard array's elements' type.
+     * @tparam N The standard array's length.
+     * @param a The standard array to be converted.
+     * @return The new n-tuple.
+     */
+    template <typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR decltype(auto) from_std(const std::array<T, N>& a)
+    {
+        return ntuple_t<T, N>(a);
+    }
+
+    /**
+     * Converts a moving standard array into a n-tuple, moving its elements.
+     * @tparam T The standard array's elements' type.
+     * @tparam N The standard array's length.
+     * @param a The standard array to be converted.
+     * @return The new n-tuple.
+     */
+    template <typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR decltype(auto) from_std(std::array<T, N>&& a)
+    {
+        return ntuple_t<T, N>(std::forward<decltype(a)>(a));
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,163 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The n-tuple extreme value operations implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/simd.hpp>
+#include <supertuple/operation/find.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+/**
+ * The policies on how NaN elements affect the extreme values of an n-tuple.
+ * @since 1.0
+ */
+enum class nan_policy_t
+{
+    propagate = 0
+  , ignore
+};
+
+namespace detail
+{
+    /**
+     * Finds the index of the extreme value of an n-tuple. With propagated NaNs, the
+     * first NaN element is itself the extreme; with ignored NaNs, the n-tuple's size
+     * is returned when all of its elements are NaNs.
+     * @tparam G Must the greatest value be found instead of the least?
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The index of the extreme value.
+     */
+    template <bool G, nan_policy_t P, typename T, size_t N>
+    inline size_t argextreme(const ntuple_t<T, N>& t)
+    {
+        static_assert(N > 0, "an empty n-tuple has no extreme value");
+        const auto data = detail::contiguous(t, std::make_index_sequence<N>());
+
+        if constexpr (std::is_arithmetic_v<T>) {
+            const T value = simd::extreme<G, P == nan_policy_t::propagate>(data.data(), N);
+            if (value == value) return simd::find(data.data(), N, value);
+            if constexpr (P == nan_policy_t::ignore) return N;
+            size_t i = 0;
+            while (i < N && data[i] == data[i]) ++i;
+            return i;
+        } else {
+            size_t best = 0;
+            for (size_t i = 1; i < N; ++i)
+                if (G ? *data[best] < *data[i] : *data[i] < *data[best]) best = i;
+            return best;
+        }
+    }
+
+    /**
+     * Finds the extreme value of an n-tuple.
+     * @tparam G Must the greatest value be found instead of the least?
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The n-tuple's extreme value.
+     */
+    template <bool G, nan_policy_t P, typename T, size_t N>
+    inline T extreme(const ntuple_t<T, N>& t)
+    {
+        static_assert(N > 0, "an empty n-tuple has no extreme value");
+
+        if constexpr (std::is_arithmetic_v<T>) {
+            const auto data = detail::contiguous(t, std::make_index_sequence<N>());
+            return simd::extreme<G, P == nan_policy_t::propagate>(data.data(), N);
+        } else {
+            return *detail::contiguous(t, std::make_index_sequence<N>())[argextreme<G, P>(t)];
+        }
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Finds the least element of an n-tuple. Unlike folding the n-tuple with a `min`
+     * functor, arithmetic elements are compared as whole vectors without any serial
+     * chain of dependencies. By default, any NaN element makes the result a NaN.
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The n-tuple's least element.
+     */
+    template <nan_policy_t P = nan_policy_t::propagate, typename T, size_t N>
+    inline T min(const ntuple_t<T, N>& t)
+    {
+        return detail::extreme<false, P>(t);
+    }
+
+    /**
+     * Finds the greatest element of an n-tuple.
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The n-tuple's greatest element.
+     */
+    template <nan_policy_t P = nan_policy_t::propagate, typename T, size_t N>
+    inline T max(const ntuple_t<T, N>& t)
+    {
+        return detail::extreme<true, P>(t);
+    }
+
+    /**
+     * Finds both the least and the greatest elements of an n-tuple.
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The pair of the n-tuple's least and greatest elements.
+     */
+    template <nan_policy_t P = nan_policy_t::propagate, typename T, size_t N>
+    inline pair_t<T, T> minmax(const ntuple_t<T, N>& t)
+    {
+        return pair_t<T, T>(detail::extreme<false, P>(t), detail::extreme<true, P>(t));
+    }
+
+    /**
+     * Finds the index of the first least element of an n-tuple.
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The index of the n-tuple's least element.
+     */
+    template <nan_policy_t P = nan_policy_t::propagate, typename T, size_t N>
+    inline size_t argmin(const ntuple_t<T, N>& t)
+    {
+        return detail::argextreme<false, P>(t);
+    }
+
+    /**
+     * Finds the index of the first greatest element of an n-tuple.
+     * @tparam P The policy on NaN elements.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The number of elements in the n-tuple.
+     * @param t The n-tuple to be searched.
+     * @return The index of the n-tuple's greatest element.
+     */
+    template <nan_policy_t P = nan_policy_t::propagate, typename T, size_t N>
+    inline size_t argmax(const ntuple_t<T, N>& t)
+    {
+        return detail::argextreme<true, P>(t);
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,195 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The tuple split operation implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Gathers references to a contiguous slice of a tuple's elements.
+     * @tparam O The slice's offset within the tuple.
+     * @tparam T The tuple's type.
+     * @tparam I The slice's sequence indeces.
+     * @param t The tuple to slice.
+     * @return The tuple of references to the slice's elements.
+     */
+    template <size_t O, typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto slice(T& t, std::index_sequence<I...>) noexcept
+    {
+        return tuple_t<decltype(operation::get<O + I>(t))...>(
+            operation::get<O + I>(t)...
+        );
+    }
+
+    /**
+     * Moves a contiguous slice of a moving tuple's elements into a new tuple.
+     * @tparam O The slice's offset within the tuple.
+     * @tparam E The tuple's declared type.
+     * @tparam T The tuple's type.
+     * @tparam I The slice's sequence indeces.
+     * @param t The tuple to slice.
+     * @return The new tuple with the slice's elements.
+     */
+    template <size_t O, typename E, typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto take(T&& t, std::index_sequence<I...>)
+    {
+        return tuple_t<tuple_element_t<E, O + I>...>(
+            operation::get<O + I>(std::forward<decltype(t)>(t))...
+        );
+    }
+
+    /**
+     * Gathers references to a contiguous slice of a n-tuple's elements.
+     * @tparam O The slice's offset within the tuple.
+     * @tparam R The slice's references' type.
+     * @tparam T The n-tuple's type.
+     * @tparam I The slice's sequence indeces.
+     * @param t The n-tuple to slice.
+     * @return The n-tuple of references to the slice's elements.
+     */
+    template <size_t O, typename R, typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto slice(T& t, std::index_sequence<I...>) noexcept
+    {
+        return ntuple_t<R, sizeof...(I)>(operation::get<O + I>(t)...);
+    }
+
+    /**
+     * Gathers references to a contiguous slice of a n-tuple's elements.
+     * @tparam O The slice's offset within the tuple.
+     * @tparam K The slice's length.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to slice.
+     * @return The n-tuple of references to the slice's elements.
+     */
+    template <size_t O, size_t K, typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR auto slice(ntuple_t<T, N>& t) noexcept
+    {
+        static_assert(O + K <= N, "slice must be within the tuple's bounds");
+        return detail::slice<O, T&>(t, std::make_index_sequence<K>());
+    }
+
+    /**
+     * Gathers references to a contiguous slice of a const-qualified n-tuple's elements.
+     * @tparam O The slice's offset within the tuple.
+     * @tparam K The slice's length.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to slice.
+     * @return The n-tuple of const-qualified references to the slice's elements.
+     */
+    template <size_t O, size_t K, typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR auto slice(const ntuple_t<T, N>& t) noexcept
+    {
+        static_assert(O + K <= N, "slice must be within the tuple's bounds");
+        return detail::slice<O, const T&>(t, std::make_index_sequence<K>());
+    }
+}
+
+inline namespace operation
+{
+    /**
+     * Splits a tuple in two at the given position, without copying its elements.
+     * The resulting pair holds references to the tuple's original elements.
+     * @tparam K The number of elements in the first part.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be split.
+     * @return The pair of references to the tuple's two parts.
+     */
+    template <size_t K, size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) split_at(
+        tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) noexcept {
+        static_assert(K <= sizeof...(T), "split position must be within the tuple's bounds");
+        return pair_t(
+            detail::slice<0>(t, std::make_index_sequence<K>())
+          , detail::slice<K>(t, std::make_index_sequence<sizeof...(T) - K>())
+        );
+    }
+
+    /**
+     * Splits a const-qualified tuple in two at the given position, without copying
+     * its elements. The resulting pair holds references to the original elements.
+     * @tparam K The number of elements in the first part.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be split.
+     * @return The pair of const-qualified references to the tuple's two parts.
+     */
+    template <size_t K, size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) split_at(
+        const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& t
+    ) noexcept {
+        static_assert(K <= sizeof...(T), "split position must be within the tuple's bounds");
+        return pair_t(
+            detail::slice<0>(t, std::make_index_sequence<K>())
+          , detail::slice<K>(t, std::make_index_sequence<sizeof...(T) - K>())
+        );
+    }
+
+    /**
+     * Splits a n-tuple in two at the given position, without copying its elements.
+     * Both parts are themselves n-tuples of references to the original elements.
+     * @tparam K The number of elements in the first part.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to be split.
+     * @return The pair of references to the n-tuple's two parts.
+     */
+    template <size_t K, typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR decltype(auto) split_at(ntuple_t<T, N>& t) noexcept
+    {
+        return pair_t(detail::slice<0, K>(t), detail::slice<K, N - K>(t));
+    }
+
+    /**
+     * Splits a const-qualified n-tuple in two at the given position, without copying
+     * its elements. Both parts are n-tuples of references to the original elements.
+     * @tparam K The number of elements in the first part.
+     * @tparam T The n-tuple's elements' type.
+     * @tparam N The n-tuple's length.
+     * @param t The n-tuple to be split.
+     * @return The pair of const-qualified references to the n-tuple's two parts.
+     */
+    template <size_t K, typename T, size_t N>
+    SUPERTUPLE_CONSTEXPR decltype(auto) split_at(const ntuple_t<T, N>& t) noexcept
+    {
+        return pair_t(detail::slice<0, K>(t), detail::slice<K, N - K>(t));
+    }
+
+    /**
+     * Splits a moving tuple in two at the given position. As a moving tuple cannot
+     * be referenced, its elements are moved into two owning tuples.
+     * @tparam K The number of elements in the first part.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The tuple's element members types.
+     * @param t The tuple to be split.
+     * @return The pair of the tuple's two parts.
+     */
+    template <size_t K, size_t ...I, typename ...T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) split_at(
+        tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>&& t
+    ) {
+        static_assert(K <= sizeof...(T), "split position must be within the tuple's bounds");
+        return pair_t(
+            detail::take<0, tuple_t<T...>>(std::forward<decltype(t)>(t), std::make_index_sequence<K>())
+          , detail::take<K, tuple_t<T...>>(std::forward<decltype(t)>(t), std::make_index_sequence<sizeof...(T) - K>())
+        );
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
@@ -0,0 +1,62 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file The tuple unzip operation implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <utility>
+
+#include <supertuple/environment.h>
+#include <supertuple/tuple.hpp>
+
+#include <supertuple/detail/utility.hpp>
+#include <supertuple/operation/get.hpp>
+
+SUPERTUPLE_BEGIN_NAMESPACE
+
+inline namespace operation
+{
+    /**
+     * Unzips a tuple of pairs into a pair of tuples, the inverse of a zip. Both
+     * tuples are built directly from references to the pairs' elements, so that
+     * each element is copied exactly once.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The pairs' first elements' types.
+     * @tparam U The pairs' second elements' types.
+     * @param t The tuple of pairs to unzip.
+     * @return The resulting pair of tuples.
+     */
+    template <size_t ...I, typename ...T, typename ...U>
+    SUPERTUPLE_CONSTEXPR decltype(auto) unzip(
+        const tuple_t<detail::identity_t<std::index_sequence<I...>>, pair_t<T, U>...>& t
+    ) {
+        return pair_t<tuple_t<T...>, tuple_t<U...>>(
+            tuple_t<const T&...>(operation::get<0>(operation::get<I>(t))...)
+          , tuple_t<const U&...>(operation::get<1>(operation::get<I>(t))...)
+        );
+    }
+
+    /**
+     * Unzips a moving tuple of pairs into a pair of tuples, the inverse of a zip.
+     * Both tuples are built directly from move-references to the pairs' elements,
+     * so that each element is moved exactly once.
+     * @tparam I The tuple's sequence indeces.
+     * @tparam T The pairs' first elements' types.
+     * @tparam U The pairs' second elements' types.
+     * @param t The tuple of pairs to unzip.
+     * @return The resulting pair of tuples.
+     */
+    template <size_t ...I, typename ...T, typename ...U>
+    SUPERTUPLE_CONSTEXPR decltype(auto) unzip(
+        tuple_t<detail::identity_t<std::index_sequence<I...>>, pair_t<T, U>...>&& t
+    ) {
+        return pair_t<tuple_t<T...>, tuple_t<U...>>(
+            tuple_t<T&&...>(operation::get<0>(operation::get<I>(std::forward<decltype(t)>(t)))...)
+          , tuple_t<U&&...>(operation::get<1>(operation::get<I>(std::forward<decltype(t)>(t)))...)
+        );
+    }
+}
+
+SUPERTUPLE_END_NAMESPACE
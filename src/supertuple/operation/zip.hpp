@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include <supertuple/environment.h>
@@ -16,6 +17,29 @@
 
 SUPERTUPLE_BEGIN_NAMESPACE
 
+namespace detail
+{
+    /**
+     * Zips two tuple-like instances by forwarding their elements.
+     * @tparam T The first tuple-like type.
+     * @tparam U The second tuple-like type.
+     * @tparam I The tuple-like types' sequence indeces.
+     * @param a The first tuple-like instance to zip.
+     * @param b The second tuple-like instance to zip.
+     * @return The resulting zipped tuple.
+     */
+    template <typename T, typename U, size_t ...I>
+    SUPERTUPLE_CONSTEXPR decltype(auto) zip(T&& a, U&& b, std::index_sequence<I...>)
+    {
+        return tuple_t(
+            pair_t<std::tuple_element_t<I, std::decay_t<T>>, std::tuple_element_t<I, std::decay_t<U>>>(
+                detail::unpack<I>(std::forward<decltype(a)>(a))
+              , detail::unpack<I>(std::forward<decltype(b)>(b))
+            )...
+        );
+    }
+}
+
 inline namespace operation
 {
     /**
@@ -63,6 +87,31 @@ inline namespace operation
             )...
         );
     }
+
+    /**
+     * Zips two tuple-like instances, of which at least one is foreign, such as a
+     * standard tuple, pair or array. The elements are forwarded directly into the
+     * resulting pairs, without converting the foreign instances beforehand.
+     * @tparam T The first tuple-like type.
+     * @tparam U The second tuple-like type.
+     * @param a The first tuple-like instance to zip.
+     * @param b The second tuple-like instance to zip.
+     * @return The resulting zipped tuple.
+     */
+    template <
+        typename T, typename U
+      , typename = std::enable_if_t<
+            detail::foreign_v<std::decay_t<T>> ||
+            detail::foreign_v<std::decay_t<U>>>>
+    SUPERTUPLE_CONSTEXPR decltype(auto) zip(T&& a, U&& b)
+    {
+        constexpr size_t N = std::tuple_size_v<std::decay_t<T>>;
+        static_assert(N == std::tuple_size_v<std::decay_t<U>>, "zipped tuples must have the same size");
+        return detail::zip(
+            std::forward<decltype(a)>(a), std::forward<decltype(b)>(b)
+          , std::make_index_sequence<N>()
+        );
+    }
 }
 
 SUPERTUPLE_END_NAMESPACE
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include <supertuple/environment.h>
@@ -68,6 +69,80 @@ namespace detail
     template <typename T, size_t ...I>
     SUPERTUPLE_CONSTEXPR auto repeater(std::index_sequence<I...>) noexcept
     -> tuple_t<typename identity_t<T, I>::type...>;
+
+    /**
+     * Checks whether a type is one of the project's own tuple types.
+     * @tparam T The type to be checked.
+     * @since 1.0
+     */
+    template <typename T, typename = void>
+    struct native_t : std::false_type {};
+
+    template <typename T>
+    struct native_t<T, std::void_t<typename T::base_tuple_t>> : std::true_type {};
+
+    template <size_t ...I, typename ...T>
+    struct native_t<tuple_t<identity_t<std::index_sequence<I...>>, T...>> : std::true_type {};
+
+    /**
+     * Checks whether a type is a foreign tuple-like type with the given number of
+     * elements, such as a standard tuple, pair or array. Foreign tuple-like types
+     * follow the standard protocol of a size trait and an indexed getter.
+     * @tparam T The type to be checked.
+     * @tparam N The expected number of elements, or any number if omitted.
+     * @since 1.0
+     */
+    template <typename T, size_t N, typename = void>
+    struct sized_t : std::false_type {};
+
+    template <typename T, size_t N>
+    struct sized_t<T, N, std::void_t<decltype(std::tuple_size<T>::value)>>
+      : std::bool_constant<N == size_t(-1) || std::tuple_size<T>::value == N> {};
+
+    template <typename T, size_t N = size_t(-1)>
+    inline constexpr bool foreign_v = std::conjunction_v<std::negation<native_t<T>>, sized_t<T, N>>;
+
+    /**
+     * Checks whether a single value must be unpacked into a single-element tuple,
+     * rather than used to directly initialize the tuple's only element.
+     * @tparam U The value's type.
+     * @tparam T The tuple's only element type.
+     * @since 1.0
+     */
+    template <typename U, typename T>
+    inline constexpr bool unpacks_v = std::conjunction_v<
+        std::bool_constant<foreign_v<std::remove_cv_t<std::remove_reference_t<U>>, 1>>
+      , std::negation<std::is_constructible<T, U>>>;
+
+    /**
+     * Retrieves an element from any tuple-like type, by argument-dependent lookup.
+     * @tparam I The requested element's index.
+     * @tparam T The tuple-like type.
+     * @param t The tuple-like instance to retrieve the element from.
+     * @return The requested element, forwarded as the tuple-like instance.
+     */
+    template <size_t I, typename T>
+    SUPERTUPLE_CONSTEXPR decltype(auto) unpack(T&& t) noexcept
+    {
+        using std::get;
+        return get<I>(std::forward<decltype(t)>(t));
+    }
+
+    /**
+     * Gathers forwarding references to all elements of a tuple-like instance, so
+     * that it can be operated on as a tuple without copying its elements.
+     * @tparam T The tuple-like type.
+     * @tparam I The tuple-like type's sequence indeces.
+     * @param t The tuple-like instance to be viewed.
+     * @return The tuple of references to the instance's elements.
+     */
+    template <typename T, size_t ...I>
+    SUPERTUPLE_CONSTEXPR auto view(T&& t, std::index_sequence<I...>) noexcept
+    {
+        return tuple_t<decltype(detail::unpack<I>(std::forward<decltype(t)>(t)))...>(
+            detail::unpack<I>(std::forward<decltype(t)>(t))...
+        );
+    }
 }
 
 /**
@@ -112,11 +187,31 @@ class tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>
          */
         template <
             typename ...U
-          , typename = std::enable_if_t<sizeof...(U) == sizeof...(T)>>
+          , typename = std::enable_if_t<
+                sizeof...(U) == sizeof...(T) &&
+                !(sizeof...(T) == 1 && (detail::unpacks_v<U, T> && ...))>>
         SUPERTUPLE_CONSTEXPR tuple_t(U&&... value)
           : detail::leaf_t<I, T> (std::forward<decltype(value)>(value))...
         {}
 
+        /**
+         * Creates a new tuple instance from a foreign tuple-like instance, such as
+         * a standard tuple, pair or array. The foreign elements are forwarded
+         * directly into the tuple, so they are moved from moving instances.
+         * @tparam U The foreign tuple-like type to build the tuple from.
+         * @param other The foreign tuple-like instance to create the tuple with.
+         * @note The constraint is a non-type parameter so that this constructor is
+         * not hidden by the n-tuple's array constructor when inherited.
+         */
+        template <
+            typename U
+          , std::enable_if_t<
+                detail::foreign_v<std::remove_cv_t<std::remove_reference_t<U>>, sizeof...(T)> &&
+                (sizeof...(T) != 1 || (detail::unpacks_v<U, T> && ...)), int> = 0>
+        SUPERTUPLE_CONSTEXPR tuple_t(U&& other)
+          : detail::leaf_t<I, T> (detail::unpack<I>(std::forward<decltype(other)>(other)))...
+        {}
+
         /**
          * Creates a new tuple instance from a tuple of foreign types.
          * @tparam U The types of foreign tuple instance to copy from.
@@ -408,6 +503,111 @@ SUPERTUPLE_CONSTEXPR bool operator!=(
     return !operator==(a, b);
 }
 
+namespace detail
+{
+    /**
+     * Compares two values and informs their relative order.
+     * @tparam T The first value's type.
+     * @tparam U The second value's type.
+     * @param a The first value to be compared.
+     * @param b The second value to be compared.
+     * @return A negative, zero or positive value whether the first value is lesser,
+     * equivalent or greater than the second one.
+     */
+    template <typename T, typename U>
+    SUPERTUPLE_CONSTEXPR int compare(const T& a, const U& b) noexcept
+    {
+        return (int) (b < a) - (int) (a < b);
+    }
+
+    /**
+     * Lexicographically compares the elements of two tuples at the given indeces.
+     * Elements are compared in order only until the first non-equivalent pair.
+     * @tparam I The indeces of the elements to be compared.
+     * @tparam T The first tuple's type.
+     * @tparam U The second tuple's type.
+     * @param a The first tuple to be compared.
+     * @param b The second tuple to be compared.
+     * @return A negative, zero or positive value whether the first tuple is lesser,
+     * equivalent or greater than the second one.
+     */
+    template <size_t ...I, typename T, typename U>
+    SUPERTUPLE_CONSTEXPR int compare(const T& a, const U& b, std::index_sequence<I...>) noexcept
+    {
+        int result = 0;
+        ((result = detail::compare(operation::get<I>(a), operation::get<I>(b))) || ...);
+        return result;
+    }
+}
+
+/**
+ * Checks whether a tuple is lexicographically lesser than another.
+ * @tparam I The tuples' sequence indeces.
+ * @tparam T The first tuple's element members types.
+ * @tparam U The second tuple's element members types.
+ * @param a The first tuple to be compared.
+ * @param b The second tuple to be compared.
+ * @return Is the first tuple lesser than the second?
+ */
+template <size_t ...I, typename ...T, typename ...U>
+SUPERTUPLE_CONSTEXPR bool operator<(
+    const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& a
+  , const tuple_t<detail::identity_t<std::index_sequence<I...>>, U...>& b
+) noexcept {
+    return detail::compare(a, b, std::index_sequence<I...>()) < 0;
+}
+
+/**
+ * Checks whether a tuple is lexicographically greater than another.
+ * @tparam I The tuples' sequence indeces.
+ * @tparam T The first tuple's element members types.
+ * @tparam U The second tuple's element members types.
+ * @param a The first tuple to be compared.
+ * @param b The second tuple to be compared.
+ * @return Is the first tuple greater than the second?
+ */
+template <size_t ...I, typename ...T, typename ...U>
+SUPERTUPLE_CONSTEXPR bool operator>(
+    const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& a
+  , const tuple_t<detail::identity_t<std::index_sequence<I...>>, U...>& b
+) noexcept {
+    return detail::compare(a, b, std::index_sequence<I...>()) > 0;
+}
+
+/**
+ * Checks whether a tuple is lexicographically lesser than or equal to another.
+ * @tparam I The tuples' sequence indeces.
+ * @tparam T The first tuple's element members types.
+ * @tparam U The second tuple's element members types.
+ * @param a The first tuple to be compared.
+ * @param b The second tuple to be compared.
+ * @return Is the first tuple lesser than or equal to the second?
+ */
+template <size_t ...I, typename ...T, typename ...U>
+SUPERTUPLE_CONSTEXPR bool operator<=(
+    const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& a
+  , const tuple_t<detail::identity_t<std::index_sequence<I...>>, U...>& b
+) noexcept {
+    return detail::compare(a, b, std::index_sequence<I...>()) <= 0;
+}
+
+/**
+ * Checks whether a tuple is lexicographically greater than or equal to another.
+ * @tparam I The tuples' sequence indeces.
+ * @tparam T The first tuple's element members types.
+ * @tparam U The second tuple's element members types.
+ * @param a The first tuple to be compared.
+ * @param b The second tuple to be compared.
+ * @return Is the first tuple greater than or equal to the second?
+ */
+template <size_t ...I, typename ...T, typename ...U>
+SUPERTUPLE_CONSTEXPR bool operator>=(
+    const tuple_t<detail::identity_t<std::index_sequence<I...>>, T...>& a
+  , const tuple_t<detail::identity_t<std::index_sequence<I...>>, U...>& b
+) noexcept {
+    return detail::compare(a, b, std::index_sequence<I...>()) >= 0;
+}
+
 SUPERTUPLE_END_NAMESPACE
 
 /**
@@ -0,0 +1,246 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the external sort of tuple datasets.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/external_sort.hpp>
+#include <supertuple/io/sink.hpp>
+#include <supertuple/io/source.hpp>
+
+namespace st = supertuple;
+
+using record_t = st::tuple_t<int32_t, uint16_t, double>;
+
+/**
+ * A reader of records from memory, in chunks of bounded sizes.
+ * @tparam T The type of records to be read.
+ * @since 1.0
+ */
+template <typename T>
+struct reader_t
+{
+    typedef T value_t;
+
+    const std::vector<T>& data;
+    size_t position = 0;
+
+    inline size_t read(T *out, size_t count)
+    {
+        count = std::min({count, data.size() - position, size_t(777)});
+        std::copy_n(data.begin() + position, count, out);
+        position += count;
+        return count;
+    }
+};
+
+/**
+ * Generates random records with a narrow range of keys, so that keys repeat.
+ * @param n The number of records to generate.
+ * @return The generated records.
+ */
+static std::vector<record_t> generate(size_t n)
+{
+    std::mt19937 rng ((unsigned) n);
+    std::uniform_int_distribution<int32_t> first (-1000, 1000);
+    std::uniform_int_distribution<uint16_t> second (0, 7);
+    std::uniform_real_distribution<double> third (-1., 1.);
+    std::vector<record_t> records (n);
+
+    for (auto& x : records) x = record_t(first(rng), second(rng), third(rng));
+    return records;
+}
+
+/**
+ * Checks whether a sequence is a permutation of the input sorted by a key.
+ * @tparam K The key selection type.
+ * @param input The unsorted input records.
+ * @param output The supposedly sorted records.
+ */
+template <typename K>
+static void check(std::vector<record_t> input, std::vector<record_t> output)
+{
+    REQUIRE(output.size() == input.size());
+
+    for (size_t i = 1; i < output.size(); ++i)
+        REQUIRE(K::template compare<K>(output[i - 1], output[i]) <= 0);
+
+    std::sort(input.begin(), input.end());
+    std::sort(output.begin(), output.end());
+    REQUIRE(output == input);
+}
+
+/**
+ * Tests whether datasets fitting the memory budget are sorted, with both radix
+ * sortable keys and keys which must be compared.
+ * @since 1.0
+ */
+TEST_CASE("external sort of datasets fitting in memory", "[external_sort]")
+{
+    const auto input = generate(5000);
+    std::vector<record_t> output;
+    auto writer = [&](const record_t *data, size_t count) { output.insert(output.end(), data, data + count); };
+
+    SECTION("radix sortable keys") {
+        reader_t<record_t> reader {input};
+        REQUIRE(st::external_sort<0, 1>(reader, writer, size_t(1) << 20, "/tmp") == input.size());
+        check<st::keys_t<0, 1>>(input, output);
+    }
+
+    SECTION("compared keys") {
+        reader_t<record_t> reader {input};
+        REQUIRE(st::external_sort<2>(reader, writer, size_t(1) << 20, "/tmp") == input.size());
+        check<st::keys_t<2>>(input, output);
+    }
+
+    SECTION("empty dataset") {
+        const std::vector<record_t> empty;
+        reader_t<record_t> reader {empty};
+        REQUIRE(st::external_sort<0>(reader, writer, size_t(1) << 20, "/tmp") == 0);
+        REQUIRE(output.empty());
+    }
+}
+
+/**
+ * Tests whether datasets larger than the memory budget are spilled into runs and
+ * merged, over multiple passes when the budget cannot hold all runs at once.
+ * @since 1.0
+ */
+TEST_CASE("external sort of datasets larger than memory", "[external_sort]")
+{
+    const auto input = generate(60000);
+    const size_t budget = GENERATE(size_t(48) << 10, size_t(1) << 20);
+    std::vector<record_t> output;
+
+    auto writer = [&](const record_t *data, size_t count) {
+        REQUIRE(count * sizeof(record_t) <= budget);
+        output.insert(output.end(), data, data + count);
+    };
+
+    SECTION("radix sortable keys") {
+        reader_t<record_t> reader {input};
+        REQUIRE(st::external_sort<1, 0>(reader, writer, budget, "/tmp") == input.size());
+        check<st::keys_t<1, 0>>(input, output);
+    }
+
+    SECTION("compared keys") {
+        reader_t<record_t> reader {input};
+        REQUIRE(st::external_sort<2, 0>(reader, writer, budget, "/tmp") == input.size());
+        check<st::keys_t<2, 0>>(input, output);
+    }
+}
+
+/**
+ * Tests whether a dataset exactly as large as a single run is sorted in memory,
+ * without spilling it, and whether a single record beyond it is carried over.
+ * @since 1.0
+ */
+TEST_CASE("external sort of datasets exactly as large as a run", "[external_sort]")
+{
+    const size_t budget = size_t(64) << 10;
+    const size_t capacity = budget / (2 * sizeof(record_t) + st::io::record_size_v<record_t>);
+
+    std::vector<record_t> output;
+    auto writer = [&](const record_t *data, size_t count) { output.insert(output.end(), data, data + count); };
+
+    SECTION("no records beyond the run") {
+        const auto input = generate(capacity);
+        reader_t<record_t> reader {input};
+        REQUIRE(st::external_sort<0, 1>(reader, writer, budget, "/nonexistent") == input.size());
+        check<st::keys_t<0, 1>>(input, output);
+    }
+
+    SECTION("one record beyond the run") {
+        const auto input = generate(capacity + 1);
+        reader_t<record_t> reader {input};
+        REQUIRE(st::external_sort<0, 1>(reader, writer, budget, "/tmp") == input.size());
+        check<st::keys_t<0, 1>>(input, output);
+    }
+}
+
+/**
+ * Tests whether runs are merged at least two at a time, even when the budget is
+ * barely larger than what a single run's blocks and the merged batch take.
+ * @since 1.0
+ */
+TEST_CASE("external sort with the least merge fan-in", "[external_sort]")
+{
+    using pair_t = st::tuple_t<uint64_t, uint64_t>;
+
+    std::mt19937_64 rng (30000);
+    std::vector<pair_t> input (30000), output;
+    for (auto& x : input) x = pair_t(rng() % 1000, rng());
+
+    reader_t<pair_t> reader {input};
+    auto writer = [&](const pair_t *data, size_t count) { output.insert(output.end(), data, data + count); };
+
+    REQUIRE(st::external_sort<0, 1>(reader, writer, size_t(400) << 10, "/tmp") == input.size());
+    REQUIRE(output.size() == input.size());
+
+    std::sort(input.begin(), input.end(), [](const pair_t& a, const pair_t& b) {
+        return st::get<0>(a) != st::get<0>(b) ? st::get<0>(a) < st::get<0>(b) : st::get<1>(a) < st::get<1>(b); });
+
+    REQUIRE(output == input);
+}
+
+/**
+ * Tests whether a dataset is sorted from a file into another, reading records with
+ * a file source and writing them through an asynchronous sink.
+ * @since 1.0
+ */
+TEST_CASE("external sort between files", "[external_sort][io]")
+{
+    char in[] = "/tmp/supertuple-XXXXXX", out[] = "/tmp/supertuple-XXXXXX";
+    ::close(::mkstemp(in));
+    ::close(::mkstemp(out));
+
+    const auto input = generate(30000);
+
+    {
+        st::io::async_sink_t sink (in);
+        sink.write(input.data(), input.size());
+    }
+
+    {
+        st::io::source_t<record_t> source (in);
+        st::io::async_sink_t sink (out);
+
+        st::external_sort<0, 1>(source, [&](const record_t *data, size_t count) {
+            sink.write(data, count); }, size_t(64) << 10, "/tmp");
+    }
+
+    std::vector<record_t> output (input.size() + 1);
+    st::io::source_t<record_t> source (out, 1000);
+
+    REQUIRE(source.read(output.data(), output.size()) == input.size());
+    output.pop_back();
+
+    check<st::keys_t<0, 1>>(input, output);
+
+    std::remove(in);
+    std::remove(out);
+}
+
+/**
+ * Tests whether a memory budget too small for a single record is rejected.
+ * @since 1.0
+ */
+TEST_CASE("external sort rejects tiny budgets", "[external_sort]")
+{
+    const auto input = generate(10);
+    reader_t<record_t> reader {input};
+    REQUIRE_THROWS_AS(st::external_sort<0>(reader, [](const record_t*, size_t) {}, 8, "/tmp"), std::invalid_argument);
+}
@@ -0,0 +1,105 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the batched geometry kernels over sets of points.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/geometry.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Generates a set of random points.
+ * @tparam T The points' coordinates' type.
+ * @tparam D The points' dimensionality.
+ * @param n The number of points to generate.
+ * @param seed The random generator's seed.
+ * @return The generated set of points.
+ */
+template <typename T, size_t D>
+static st::points_t<T, D> generate(size_t n, unsigned seed)
+{
+    std::mt19937 rng (seed);
+    std::uniform_real_distribution<T> dist (-10, 10);
+    st::points_t<T, D> points;
+
+    for (size_t i = 0; i < n; ++i) {
+        T p[D];
+        for (size_t d = 0; d < D; ++d) p[d] = dist(rng);
+        points.push_back(st::ntuple_t<T, D>(p));
+    }
+
+    return points;
+}
+
+/**
+ * Computes the distance between two points of sets naively.
+ * @tparam T The points' coordinates' type.
+ * @tparam D The points' dimensionality.
+ * @param a The first point's set.
+ * @param i The first point's index.
+ * @param b The second point's set.
+ * @param j The second point's index.
+ * @return The distance between the points.
+ */
+template <typename T, size_t D>
+static double naive(const st::points_t<T, D>& a, size_t i, const st::points_t<T, D>& b, size_t j)
+{
+    const auto p = a.gather(i), q = b.gather(j);
+    const double total = st::foldl(
+        st::zipwith(p, q, [](T x, T y) { return (double) (x - y) * (x - y); })
+      , [](double x, double y) { return x + y; });
+    return std::sqrt(total);
+}
+
+/**
+ * Tests whether distance matrices match naive distances, for several dimensions.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE_SIG("tiled distance matrices", "[geometry]", ((size_t D), D), 1, 2, 3, 7)
+{
+    const auto a = generate<double, D>(150, 1);
+    const auto b = generate<double, D>(2100, 2);
+    const size_t threads = GENERATE(1, 3);
+
+    std::vector<double> out (a.size() * b.size());
+    st::distance_matrix(a, b, out.data(), false, threads);
+
+    for (size_t i = 0; i < a.size(); i += 7)
+        for (size_t j = 0; j < b.size(); j += 13)
+            REQUIRE(out[i * b.size() + j] == Approx(naive<double, D>(a, i, b, j)));
+}
+
+/**
+ * Tests whether the brute-force kNN finds the same neighbours as a full sort.
+ * @since 1.0
+ */
+TEST_CASE("brute-force k-nearest neighbours", "[geometry][knn]")
+{
+    const auto queries = generate<float, 3>(40, 3);
+    const auto points = generate<float, 3>(5000, 4);
+
+    const auto result = st::knn(queries, points, 8, 4);
+    REQUIRE(result.k == 8);
+
+    for (size_t q = 0; q < queries.size(); ++q) {
+        std::vector<std::pair<double, size_t>> expected;
+        for (size_t j = 0; j < points.size(); ++j)
+            expected.push_back({naive<float, 3>(queries, q, points, j), j});
+        std::sort(expected.begin(), expected.end());
+
+        for (size_t i = 0; i < result.k; ++i) {
+            REQUIRE(result.index[q * result.k + i] == expected[i].second);
+            REQUIRE(result.distance[q * result.k + i] == Approx(expected[i].first).epsilon(1e-4));
+        }
+    }
+
+    REQUIRE(st::knn(queries, generate<float, 3>(3, 5), 8).k == 3);
+}
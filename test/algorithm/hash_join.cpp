@@ -0,0 +1,93 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the partitioned parallel hash join of tuple relations.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/hash_join.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether the hash join emits exactly the same pairs as a naive join would,
+ * whatever the number of threads joining the relations.
+ * @since 1.0
+ */
+TEST_CASE("partitioned hash join of relations", "[join][hash]")
+{
+    using user_t = st::tuple_t<uint32_t, int, std::string>;
+    using visit_t = st::tuple_t<uint32_t, int, double>;
+
+    const size_t threads = GENERATE(1, 4);
+
+    std::mt19937 rng (7);
+    std::vector<user_t> users;
+    std::vector<visit_t> visits;
+    std::map<st::tuple_t<uint32_t, int>, size_t> expected;
+
+    for (uint32_t i = 0; i < 30000; ++i)
+        users.push_back(user_t(i % 20000, (int) (i % 3), std::to_string(i)));
+
+    for (uint32_t i = 0; i < 50000; ++i)
+        visits.push_back(visit_t(rng() % 25000, (int) (rng() % 3), i * .5));
+
+    for (const auto& user : users)
+        ++expected[st::tuple_t(st::get<0>(user), st::get<1>(user))];
+
+    size_t naive = 0;
+
+    for (const auto& visit : visits) {
+        auto it = expected.find(st::tuple_t(st::get<0>(visit), st::get<1>(visit)));
+        if (it != expected.end()) naive += it->second;
+    }
+
+    std::vector<size_t> emitted (threads, 0);
+    std::vector<size_t> mismatches (threads, 0);
+
+    auto stats = st::hash_join<0, 1>(users, visits, [&](auto row, size_t worker) {
+        mismatches[worker] += st::get<0>(row) != st::get<3>(row) || st::get<1>(row) != st::get<4>(row);
+        ++emitted[worker];
+    }, threads);
+
+    size_t total = 0;
+    for (size_t count : emitted) total += count;
+
+    REQUIRE(stats.threads == threads);
+    REQUIRE(stats.matches == naive);
+    REQUIRE(total == naive);
+    REQUIRE(std::count(mismatches.begin(), mismatches.end(), 0) == (long) threads);
+    REQUIRE(stats.build.size() == stats.partitions);
+    REQUIRE(std::accumulate(stats.build.begin(), stats.build.end(), size_t(0)) == users.size());
+    REQUIRE(std::accumulate(stats.probe.begin(), stats.probe.end(), size_t(0)) == visits.size());
+    REQUIRE(stats.largest <= users.size());
+}
+
+/**
+ * Tests whether relations can be joined on keys at different indeces.
+ * @since 1.0
+ */
+TEST_CASE("hash join on differently placed keys", "[join][hash]")
+{
+    std::vector<st::tuple_t<int, std::string>> names = {{1, "one"}, {2, "two"}, {3, "three"}};
+    std::vector<st::tuple_t<std::string, int>> labels = {{"uno", 1}, {"tres", 3}, {"tri", 3}, {"cinco", 5}};
+    std::vector<std::string> joined;
+
+    auto stats = st::hash_join<st::keys_t<0>, st::keys_t<1>>(names, labels, [&](auto row, size_t) {
+        joined.push_back(st::get<1>(row) + ":" + st::get<2>(row));
+    }, 1);
+
+    std::sort(joined.begin(), joined.end());
+
+    REQUIRE(stats.matches == 3);
+    REQUIRE(joined == std::vector<std::string>{"one:uno", "three:tres", "three:tri"});
+}
@@ -0,0 +1,86 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the sort-merge join of sorted tuple sequences.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/join.hpp>
+
+namespace st = supertuple;
+
+using order_t = st::tuple_t<int, std::string>;
+using price_t = st::tuple_t<double, int>;
+
+static const std::vector<order_t> orders = {
+    {1, "apple"}, {2, "pear"}, {2, "plum"}, {4, "kiwi"}, {5, "fig"}
+};
+
+static const std::vector<price_t> prices = {
+    {.5, 0}, {1.5, 2}, {2.5, 2}, {3.5, 3}, {4.5, 4}, {5.5, 4}
+};
+
+/**
+ * Tests whether inner joins emit the cross products of runs of equivalent keys, with
+ * rows referencing the joined tuples' elements.
+ * @since 1.0
+ */
+TEST_CASE("merge inner join on key indeces", "[join][merge]")
+{
+    std::vector<st::tuple_t<int, std::string, double, int>> rows;
+
+    const size_t total = st::merge_join<st::keys_t<0>, st::keys_t<1>>(orders, prices, [&](auto row) {
+        static_assert(std::is_same_v<decltype(row), st::tuple_t<const int&, const std::string&, const double&, const int&>>);
+        rows.push_back(row);
+    });
+
+    REQUIRE(total == 6);
+    REQUIRE(rows.size() == 6);
+    REQUIRE(rows[0] == st::tuple_t(2, std::string("pear"), 1.5, 2));
+    REQUIRE(rows[1] == st::tuple_t(2, std::string("pear"), 2.5, 2));
+    REQUIRE(rows[2] == st::tuple_t(2, std::string("plum"), 1.5, 2));
+    REQUIRE(rows[3] == st::tuple_t(2, std::string("plum"), 2.5, 2));
+    REQUIRE(rows[4] == st::tuple_t(4, std::string("kiwi"), 4.5, 4));
+    REQUIRE(rows[5] == st::tuple_t(4, std::string("kiwi"), 5.5, 4));
+}
+
+/**
+ * Tests whether left and full outer joins emit unmatched rows, informing which of
+ * the sides have contributed to each row.
+ * @since 1.0
+ */
+TEST_CASE("merge outer joins emit unmatched rows", "[join][merge]")
+{
+    using row_t = st::tuple_t<int, std::string, double, int>;
+    std::vector<st::pair_t<row_t, st::join_match_t>> rows;
+
+    auto collect = [&](row_t row, st::join_match_t match) {
+        rows.push_back({row, match});
+    };
+
+    SECTION("left join") {
+        st::merge_join<st::keys_t<0>, st::keys_t<1>, st::join_t::left, st::join_output_t::concat>(orders, prices, collect);
+
+        REQUIRE(rows.size() == 8);
+        REQUIRE(rows.front().first() == row_t(1, "apple", 0., 0));
+        REQUIRE(rows.front().second() == st::join_match_t::left);
+        REQUIRE(rows.back().first() == row_t(5, "fig", 0., 0));
+        REQUIRE(rows.back().second() == st::join_match_t::left);
+    }
+
+    SECTION("full outer join") {
+        st::merge_join<st::keys_t<0>, st::keys_t<1>, st::join_t::outer>(orders, prices, collect);
+
+        REQUIRE(rows.size() == 10);
+        REQUIRE(rows[0].first() == row_t(0, "", .5, 0));
+        REQUIRE(rows[0].second() == st::join_match_t::right);
+        REQUIRE(rows[1].second() == st::join_match_t::left);
+        REQUIRE(rows[6].first() == row_t(0, "", 3.5, 3));
+        REQUIRE(rows[6].second() == st::join_match_t::right);
+        REQUIRE(rows[9].second() == st::join_match_t::left);
+    }
+}
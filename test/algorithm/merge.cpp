@@ -0,0 +1,146 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the k-way merge of sorted tuple sequences.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/merge.hpp>
+
+namespace st = supertuple;
+
+using record_t = st::tuple_t<int32_t, uint16_t, std::string>;
+
+/**
+ * Generates sorted runs of records with random composite keys.
+ * @param k The number of runs to generate.
+ * @param n The maximum number of records in each run.
+ * @return The generated runs.
+ */
+static std::vector<std::vector<record_t>> generate(size_t k, size_t n)
+{
+    std::mt19937 rng ((unsigned) (k * 31 + n));
+    std::uniform_int_distribution<int32_t> first (-50, 50);
+    std::uniform_int_distribution<uint16_t> second (0, 3);
+    std::vector<std::vector<record_t>> runs (k);
+
+    for (size_t r = 0; r < k; ++r) {
+        const size_t count = rng() % (n + 1);
+        for (size_t i = 0; i < count; ++i)
+            runs[r].push_back(record_t(first(rng), second(rng), std::to_string(r)));
+        std::stable_sort(runs[r].begin(), runs[r].end(), [](const auto& a, const auto& b) {
+            return st::keys_t<0, 1>::compare<st::keys_t<0, 1>>(a, b) < 0; });
+    }
+
+    return runs;
+}
+
+/**
+ * Tests whether normalized keys preserve the order of their elements, including
+ * the order of negative integers.
+ * @since 1.0
+ */
+TEST_CASE("normalized keys preserve lexicographical order", "[merge][keys]")
+{
+    using key_t = st::keys_t<0, 1>;
+
+    STATIC_REQUIRE(key_t::normalizable<record_t>);
+    STATIC_REQUIRE(!st::keys_t<2>::normalizable<record_t>);
+    STATIC_REQUIRE(!st::keys_t<0, 1>::normalizable<st::tuple_t<int64_t, int8_t>>);
+
+    using pair_t = st::tuple_t<int32_t, uint16_t>;
+
+    STATIC_REQUIRE(key_t::normalize(pair_t(-1, 5)) < key_t::normalize(pair_t(0, 0)));
+    STATIC_REQUIRE(key_t::normalize(pair_t(-7, 2)) < key_t::normalize(pair_t(-7, 3)));
+    STATIC_REQUIRE(key_t::normalize(pair_t(3, 65535)) < key_t::normalize(pair_t(4, 0)));
+}
+
+/**
+ * Tests whether merging sorted runs produces the same sequence as a stable sort of
+ * all records, in batches no larger than requested.
+ * @since 1.0
+ */
+TEST_CASE("k-way merge of sorted runs", "[merge]")
+{
+    for (size_t k : {0, 1, 2, 3, 7, 32}) {
+        const auto runs = generate(k, 40);
+        std::vector<record_t> merged, expected;
+
+        const size_t total = st::kway_merge<0, 1>(runs, [&](const record_t *data, size_t count) {
+            REQUIRE(count > 0);
+            REQUIRE(count <= 16);
+            merged.insert(merged.end(), data, data + count);
+        }, nullptr, 16);
+
+        for (const auto& run : runs) expected.insert(expected.end(), run.begin(), run.end());
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+            return st::keys_t<0, 1>::compare<st::keys_t<0, 1>>(a, b) < 0; });
+
+        REQUIRE(total == expected.size());
+        REQUIRE(merged == expected);
+    }
+}
+
+/**
+ * Tests whether duplicated keys are collapsed by the resolver in the order of the
+ * runs, such that assignment keeps the record of the last run.
+ * @since 1.0
+ */
+TEST_CASE("k-way merge with last-writer-wins resolution", "[merge]")
+{
+    const auto runs = generate(9, 60);
+    std::vector<record_t> merged;
+
+    st::kway_merge<0, 1>(runs, [&](const record_t *data, size_t count) {
+        merged.insert(merged.end(), data, data + count);
+    }, [](record_t& current, const record_t& next) { current = next; }, 5);
+
+    std::vector<record_t> expected;
+    for (const auto& run : runs) expected.insert(expected.end(), run.begin(), run.end());
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return st::keys_t<0, 1>::compare<st::keys_t<0, 1>>(a, b) < 0; });
+
+    std::vector<record_t> unique;
+    for (const auto& x : expected) {
+        if (!unique.empty() && st::keys_t<0, 1>::compare<st::keys_t<0, 1>>(unique.back(), x) == 0)
+            unique.back() = x;
+        else unique.push_back(x);
+    }
+
+    REQUIRE(merged == unique);
+}
+
+/**
+ * Tests whether keys which cannot be normalized are merged through comparisons of
+ * their elements, and resolved by an accumulating resolver.
+ * @since 1.0
+ */
+TEST_CASE("k-way merge on non-normalizable keys", "[merge]")
+{
+    using entry_t = st::tuple_t<std::string, int>;
+
+    const std::vector<std::vector<entry_t>> runs = {
+        {{"apple", 1}, {"kiwi", 2}, {"pear", 3}}
+      , {{"fig", 10}, {"kiwi", 20}}
+      , {}
+      , {{"apple", 100}, {"plum", 200}}
+    };
+
+    std::vector<entry_t> merged;
+
+    const size_t total = st::kway_merge<0>(runs, [&](const entry_t *data, size_t count) {
+        merged.insert(merged.end(), data, data + count);
+    }, [](entry_t& current, const entry_t& next) { st::get<1>(current) += st::get<1>(next); });
+
+    REQUIRE(total == 5);
+    REQUIRE(merged == std::vector<entry_t> {
+        {"apple", 101}, {"fig", 10}, {"kiwi", 22}, {"pear", 3}, {"plum", 200}});
+}
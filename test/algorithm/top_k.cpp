@@ -0,0 +1,160 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the top-k selection of tuples by a projected key element.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/top_k.hpp>
+
+namespace st = supertuple;
+
+using record_t = st::tuple_t<std::string, int64_t, double>;
+
+/**
+ * Generates a sequence of records with random scores.
+ * @param n The number of records to generate.
+ * @return The generated records.
+ */
+static std::vector<record_t> generate(size_t n)
+{
+    std::mt19937_64 rng (13);
+    std::vector<record_t> records;
+
+    for (size_t i = 0; i < n; ++i)
+        records.push_back(record_t(std::to_string(i), (int64_t) (rng() % 1000000), (double) i));
+
+    return records;
+}
+
+/**
+ * Tests whether the top-k selection finds the same keys as a full sort, both serially
+ * and by merging per-thread heaps.
+ * @since 1.0
+ */
+TEST_CASE("top-k selection by a key element", "[top_k]")
+{
+    const size_t threads = GENERATE(1, 4);
+    const auto records = generate(100000);
+
+    std::vector<int64_t> expected;
+    for (const auto& record : records) expected.push_back(st::get<1>(record));
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+
+    const auto top = st::top_k<1>(records, 100, std::greater<>(), threads);
+    REQUIRE(top.size() == 100);
+
+    for (size_t i = 0; i < top.size(); ++i)
+        REQUIRE(st::get<1>(top[i]) == expected[i]);
+
+    const auto bottom = st::top_k<1>(records, 10, std::less<>(), threads);
+    REQUIRE(st::get<1>(bottom[0]) == expected.back());
+
+    const auto all = st::top_k<2>(generate(5), 10);
+    REQUIRE(all.size() == 5);
+    REQUIRE(st::get<0>(all[0]) == "4");
+}
+
+/**
+ * Tests whether an error thrown by the ranking comparator on any of the scanning
+ * threads is propagated to the caller, once all threads have been joined.
+ * @since 1.0
+ */
+TEST_CASE("top-k selection propagates errors from worker threads", "[top_k]")
+{
+    const auto records = generate(100000);
+    const int64_t poison = st::get<1>(records[GENERATE(0, 99999)]);
+
+    auto cmp = [poison](int64_t a, int64_t b) {
+        if (a == poison || b == poison) throw std::runtime_error("poisoned key");
+        return a > b;
+    };
+
+    REQUIRE_THROWS_AS(st::top_k<1>(records, 10, cmp, 4), std::runtime_error);
+}
+
+/**
+ * Tests whether sequences without random access are selected from by keeping copies
+ * of the selected tuples.
+ * @since 1.0
+ */
+TEST_CASE("top-k selection over a forward sequence", "[top_k]")
+{
+    const auto records = generate(1000);
+    const std::list<record_t> list (records.begin(), records.end());
+
+    const auto expected = st::top_k<1>(records, 7);
+    const auto top = st::top_k<1>(list, 7);
+
+    REQUIRE(top.size() == 7);
+    for (size_t i = 0; i < top.size(); ++i)
+        REQUIRE(st::get<1>(top[i]) == st::get<1>(expected[i]));
+}
+
+/**
+ * A payload which counts how many times it has been copied.
+ * @since 1.0
+ */
+struct counted_t
+{
+    inline static size_t copies = 0;
+
+    counted_t() = default;
+    counted_t(counted_t&&) = default;
+    counted_t(const counted_t&) { ++copies; }
+    counted_t& operator=(counted_t&&) = default;
+    counted_t& operator=(const counted_t&) { ++copies; return *this; }
+};
+
+/**
+ * Tests whether tuples of a forward sequence are only copied when admitted, so that
+ * tuples rejected by the threshold are never copied.
+ * @since 1.0
+ */
+TEST_CASE("top-k selection only copies admitted tuples", "[top_k]")
+{
+    std::list<st::tuple_t<int, counted_t>> list;
+    for (int i = 1000; i > 0; --i) list.emplace_back(i, counted_t());
+
+    counted_t::copies = 0;
+    const auto top = st::top_k<0>(list, 5);
+
+    REQUIRE(top.size() == 5);
+    REQUIRE(st::get<0>(top[0]) == 1000);
+    REQUIRE(st::get<0>(top[4]) == 996);
+    REQUIRE(counted_t::copies == 5);
+}
+
+/**
+ * Tests whether the top-k selection over structure-of-arrays containers gathers the
+ * payload columns of the selected rows.
+ * @since 1.0
+ */
+TEST_CASE("top-k selection over a structure-of-arrays", "[top_k][soa]")
+{
+    const auto records = generate(50000);
+    st::soa_t<std::string, int64_t, double> soa;
+
+    for (const auto& record : records)
+        soa.push_back(record);
+
+    const auto expected = st::top_k<1>(records, 50);
+    const auto top = st::top_k<1>(soa, 50, std::greater<>(), 4);
+
+    REQUIRE(top.size() == 50);
+
+    for (size_t i = 0; i < top.size(); ++i) {
+        REQUIRE(top[i] == expected[i]);
+        REQUIRE(top.column<0>()[i] == std::to_string((size_t) top.column<2>()[i]));
+    }
+}
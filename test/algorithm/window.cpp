@@ -0,0 +1,110 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the sliding-window aggregation over tuple streams.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/algorithm/window.hpp>
+
+namespace st = supertuple;
+
+using stats_t = st::tuple_t<size_t, int64_t, int64_t, int64_t>;
+
+static const auto add = [](auto a, auto b) { return a + b; };
+static const auto min = [](auto a, auto b) { return std::min(a, b); };
+static const auto max = [](auto a, auto b) { return std::max(a, b); };
+
+static const stats_t identity = stats_t(
+    0, 0
+  , std::numeric_limits<int64_t>::max()
+  , std::numeric_limits<int64_t>::min());
+
+/**
+ * Tests whether a count-based window keeps the rolling count, sum, min and max of
+ * the last events, by comparing it against a naive recomputation.
+ * @since 1.0
+ */
+TEST_CASE("count-based sliding window aggregation", "[window]")
+{
+    constexpr size_t W = 50;
+
+    std::mt19937 rng (3);
+    std::vector<int64_t> events;
+    auto window = st::sliding_window<W>(identity, add, add, min, max);
+
+    for (size_t i = 0; i < 2000; ++i) {
+        const int64_t x = (int64_t) (rng() % 1000) - 500;
+        events.push_back(x);
+        window.push(stats_t(1, x, x, x));
+
+        const size_t first = events.size() > W ? events.size() - W : 0;
+        const auto result = window.query();
+
+        REQUIRE(st::get<0>(result) == events.size() - first);
+        REQUIRE(st::get<1>(result) == std::accumulate(events.begin() + first, events.end(), int64_t(0)));
+        REQUIRE(st::get<2>(result) == *std::min_element(events.begin() + first, events.end()));
+        REQUIRE(st::get<3>(result) == *std::max_element(events.begin() + first, events.end()));
+    }
+
+    REQUIRE(window.size() == W);
+}
+
+/**
+ * Tests whether the window combines tuples in order, so that non-commutative
+ * combiners can also be used.
+ * @since 1.0
+ */
+TEST_CASE("sliding window combines tuples in order", "[window]")
+{
+    auto window = st::sliding_window<3>(st::tuple_t(std::string()), add);
+
+    for (const char *word : {"a", "b", "c", "d", "e"})
+        window.push(st::tuple_t(std::string(word)));
+
+    REQUIRE(st::get<0>(window.query()) == "cde");
+
+    window.clear();
+
+    REQUIRE(window.size() == 0);
+    REQUIRE(st::get<0>(window.query()) == "");
+}
+
+/**
+ * Tests whether a time-based window only aggregates the events within its span.
+ * @since 1.0
+ */
+TEST_CASE("time-based sliding window aggregation", "[window][time]")
+{
+    using namespace std::chrono_literals;
+    auto window = st::sliding_window(10ms, identity, add, add, min, max);
+
+    window.push(0ms, stats_t(1, 5, 5, 5));
+    window.push(4ms, stats_t(1, 1, 1, 1));
+    window.push(9ms, stats_t(1, 7, 7, 7));
+
+    REQUIRE(window.query() == stats_t(3, 13, 1, 7));
+
+    window.push(12ms, stats_t(1, 3, 3, 3));
+
+    REQUIRE(window.query() == stats_t(3, 11, 1, 7));
+
+    window.advance(15ms);
+
+    REQUIRE(window.query() == stats_t(2, 10, 3, 7));
+
+    window.advance(30ms);
+
+    REQUIRE(window.size() == 0);
+    REQUIRE(window.query() == identity);
+}
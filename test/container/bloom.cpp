@@ -0,0 +1,61 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the bloom filters over tuple keys.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/bloom.hpp>
+
+namespace st = supertuple;
+
+using record_t = st::tuple_t<int, std::string>;
+
+/**
+ * Tests whether bloom filters never report false negatives, including for probes
+ * made with tuples of references, and whether their false positive rate stays close
+ * to the configured target.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE(
+    "bloom filters over tuple keys", "[bloom]"
+  , st::bloom_filter<record_t>
+  , st::blocked_bloom_filter<record_t>
+) {
+    constexpr size_t count = 10000;
+    TestType filter (count, .01);
+
+    for (int i = 0; i < (int) count; ++i)
+        filter.insert(st::tuple_t(i, std::to_string(i)));
+
+    size_t negatives = 0;
+
+    for (int i = 0; i < (int) count; ++i) {
+        std::string name = std::to_string(i);
+        negatives += !filter.contains(st::tie(i, name));
+    }
+
+    REQUIRE(negatives == 0);
+
+    std::vector<record_t> probes;
+    std::vector<uint8_t> result (count);
+    std::vector<bool> flags;
+
+    for (int i = 0; i < (int) count; ++i)
+        probes.push_back(st::tuple_t(i + (int) count, std::to_string(i)));
+
+    const size_t positives = filter.contains_n(probes.begin(), count, result.begin());
+
+    REQUIRE(positives < count * 3 / 100);
+    REQUIRE(positives == (size_t) std::count(result.begin(), result.end(), 1));
+    REQUIRE(filter.contains_n(probes.begin(), count, std::back_inserter(flags)) == positives);
+    REQUIRE(std::equal(flags.begin(), flags.end(), result.begin()));
+    REQUIRE(filter.contains(st::tuple_t(7, std::string("7"))));
+}
@@ -0,0 +1,163 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the B+tree map keyed by tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/btree.hpp>
+
+namespace st = supertuple;
+
+using event_t = st::tuple_t<int, int64_t, uint32_t>;
+
+/**
+ * Tests whether tuples are lexicographically ordered by their elements.
+ * @since 1.0
+ */
+TEST_CASE("tuples are lexicographically ordered", "[btree][ordering]")
+{
+    REQUIRE(st::tuple_t(1, 2, 3) < st::tuple_t(1, 2, 4));
+    REQUIRE(st::tuple_t(1, 3, 0) > st::tuple_t(1, 2, 9));
+    REQUIRE(st::tuple_t(2, 0.5) <= st::tuple_t(2, 0.5));
+    REQUIRE(st::tuple_t(std::string("b"), 1) >= st::tuple_t(std::string("a"), 7));
+    REQUIRE_FALSE(st::tuple_t(1, 2) < st::tuple_t(1, 2));
+}
+
+/**
+ * Tests whether the map keeps its keys in order while many random keys are inserted,
+ * looked up and erased, by comparing it against a standard ordered map.
+ * @since 1.0
+ */
+TEST_CASE("b+tree maps keep random keys in order", "[btree]")
+{
+    using key_t = std::tuple<int, int64_t, uint32_t>;
+
+    std::mt19937 rng (42);
+    std::map<key_t, int> expected;
+    st::btree_map<event_t, int, 8> map;
+
+    for (int i = 0; i < 20000; ++i) {
+        const int tenant = (int) (rng() % 16);
+        const int64_t timestamp = (int64_t) (rng() % 1000);
+        const uint32_t sequence = rng() % 4;
+
+        const bool inserted = map.insert(st::tuple_t(tenant, timestamp, sequence), i).second;
+        REQUIRE(inserted == expected.emplace(key_t(tenant, timestamp, sequence), i).second);
+    }
+
+    REQUIRE(map.size() == expected.size());
+
+    for (int i = 0; i < 5000; ++i) {
+        const int tenant = (int) (rng() % 16);
+        const int64_t timestamp = (int64_t) (rng() % 1000);
+        const uint32_t sequence = rng() % 4;
+
+        REQUIRE(map.erase(st::tie(tenant, timestamp, sequence)) == (bool) expected.erase(key_t(tenant, timestamp, sequence)));
+    }
+
+    auto it = expected.begin();
+
+    for (auto [key, value] : map) {
+        REQUIRE(it != expected.end());
+        REQUIRE(std::get<0>(it->first) == st::get<0>(key));
+        REQUIRE(std::get<1>(it->first) == st::get<1>(key));
+        REQUIRE(std::get<2>(it->first) == st::get<2>(key));
+        REQUIRE(it->second == value);
+        ++it;
+    }
+
+    REQUIRE(it == expected.end());
+    REQUIRE(map.size() == expected.size());
+
+    for (const auto& [key, value] : expected) {
+        auto found = map.find(st::tuple_t(std::get<0>(key), std::get<1>(key), std::get<2>(key)));
+        REQUIRE(found != map.end());
+        REQUIRE(found.value() == value);
+    }
+
+    REQUIRE(map.find(st::tuple_t(99, (int64_t) 0, 0u)) == map.end());
+}
+
+/**
+ * Tests whether prefix and range queries retrieve exactly the keys they cover, and
+ * whether leaf scans visit the same elements as iterators do.
+ * @since 1.0
+ */
+TEST_CASE("b+tree maps answer prefix and range queries", "[btree][range]")
+{
+    st::btree_map<event_t, std::string> map;
+
+    for (int tenant = 0; tenant < 10; ++tenant)
+        for (int64_t timestamp = 0; timestamp < 100; ++timestamp)
+            for (uint32_t sequence = 0; sequence < 3; ++sequence)
+                map.insert(st::tuple_t(tenant, timestamp, sequence), std::to_string(tenant));
+
+    REQUIRE(map.size() == 3000);
+
+    size_t count = 0;
+
+    for (auto [key, value] : map.equal_prefix(st::tuple_t(4))) {
+        REQUIRE(st::get<0>(key) == 4);
+        REQUIRE(value == "4");
+        ++count;
+    }
+
+    REQUIRE(count == 300);
+
+    auto range = map.equal_prefix(st::tuple_t(7, (int64_t) 42));
+    REQUIRE(st::get<2>(range.begin().key()) == 0);
+
+    size_t total = 0;
+    map.scan(range.first, range.last, [&](auto key, const std::string& value) {
+        REQUIRE(st::get<0>(key) == 7);
+        REQUIRE(st::get<1>(key) == 42);
+        REQUIRE(value == "7");
+        ++total;
+    });
+
+    REQUIRE(total == 3);
+
+    auto first = map.lower_bound(st::tuple_t(2, (int64_t) 50));
+    auto last = map.upper_bound(st::tuple_t(3, (int64_t) 10));
+    size_t scanned = 0;
+
+    map.scan(first, last, [&](auto, const std::string&) { ++scanned; });
+
+    REQUIRE(scanned == (50 + 11) * 3);
+    REQUIRE(map.equal_prefix(st::tuple_t(12)).empty());
+    REQUIRE(map.upper_bound(st::tuple_t(9)) == map.end());
+}
+
+/**
+ * Tests whether move-only values are moved into the map, both when their keys are
+ * inserted and when their mapped values are replaced.
+ * @since 1.0
+ */
+TEST_CASE("b+tree maps hold move-only values", "[btree]")
+{
+    st::btree_map<st::tuple_t<int, int>, std::unique_ptr<int>, 4> map;
+
+    for (int i = 0; i < 100; ++i)
+        map.insert_or_assign(st::tuple_t(i % 10, i / 10), std::make_unique<int>(i));
+
+    REQUIRE(map.size() == 100);
+
+    auto replaced = std::make_unique<int>(-1);
+    const auto it = map.insert_or_assign(st::tuple_t(3, 4), std::move(replaced));
+
+    REQUIRE(replaced == nullptr);
+    REQUIRE(*it.value() == -1);
+    REQUIRE(map.size() == 100);
+    REQUIRE(*map.find(st::tuple_t(9, 9)).value() == 99);
+    REQUIRE(map.insert(st::tuple_t(50, 0), std::make_unique<int>(7)).second);
+}
@@ -0,0 +1,178 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the incremental checkpoints of columnar tables.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/checkpoint.hpp>
+
+namespace st = supertuple;
+
+using table_t = st::tracked_soa_t<uint32_t, double, char>;
+
+/**
+ * Creates a new empty temporary file.
+ * @return The path of the created file.
+ */
+static std::string tempfile()
+{
+    char name[] = "/tmp/supertuple-XXXXXX";
+    ::close(::mkstemp(name));
+    return name;
+}
+
+/**
+ * Checks whether two tables hold the same rows.
+ * @param a The first table to be compared.
+ * @param b The second table to be compared.
+ */
+static void check(const table_t& a, const table_t& b)
+{
+    REQUIRE(a.size() == b.size());
+    REQUIRE(a.column<0>() == b.column<0>());
+    REQUIRE(a.column<1>() == b.column<1>());
+    REQUIRE(a.column<2>() == b.column<2>());
+}
+
+/**
+ * Tests whether writes through the table mark only the blocks they touch, in the
+ * columns they touch, and whether checkpoints clean all blocks.
+ * @since 1.0
+ */
+TEST_CASE("tracked table marks dirty blocks on writes", "[checkpoint]")
+{
+    const std::string path = tempfile();
+    table_t table (1000, 100);
+
+    REQUIRE(table.dirty() == 30);
+    table.checkpoint(path, true);
+    REQUIRE(table.dirty() == 0);
+
+    table.at<0>(5) = 1;
+    table.at<0>(99) = 2;
+    REQUIRE(table.dirty() == 1);
+
+    table.at<1>(450) = 3.;
+    table.assign(999, st::tuple_t<uint32_t, double, char>(7, 8., 'x'));
+    REQUIRE(table.dirty() == 5);
+
+    auto *data = table.span<2>(150, 301);
+    data[0] = data[150] = 'y';
+    REQUIRE(table.dirty() == 8);
+
+    table.push_back(st::tuple_t<uint32_t, double, char>(1, 1., 'z'));
+    REQUIRE(table.dirty() == 11);
+
+    table.checkpoint(path);
+    REQUIRE(table.dirty() == 0);
+
+    std::remove(path.c_str());
+}
+
+/**
+ * Tests whether incremental checkpoints only hold the changed blocks, and whether a
+ * table is restored by replaying a full checkpoint and its incremental ones.
+ * @since 1.0
+ */
+TEST_CASE("tracked table restores from base and deltas", "[checkpoint]")
+{
+    const std::string base = tempfile(), first = tempfile(), second = tempfile();
+    table_t table (10000, 256);
+
+    for (size_t i = 0; i < table.size(); ++i)
+        table.assign(i, st::tuple_t<uint32_t, double, char>((uint32_t) i, i * .5, char('a' + i % 26)));
+
+    const size_t full = table.checkpoint(base, true);
+
+    for (size_t i = 0; i < table.size(); i += 2500) table.at<1>(i) = -1.;
+    const size_t delta = table.checkpoint(first);
+
+    REQUIRE(delta < full / 10);
+
+    table.resize(12345);
+    table.at<2>(3) = '!';
+    table.checkpoint(second);
+
+    table_t restored (0, 64);
+    restored.restore({base, first, second});
+
+    check(restored, table);
+    REQUIRE(restored.dirty() == 0);
+
+    table_t partial;
+    partial.restore({base, first});
+    REQUIRE(partial.size() == 10000);
+    REQUIRE(partial.column<1>()[2500] == -1.);
+    REQUIRE(partial.column<2>()[3] == 'd');
+
+    std::remove(base.c_str());
+    std::remove(first.c_str());
+    std::remove(second.c_str());
+}
+
+/**
+ * Tests whether successive checkpoints appended to a single open file are restored
+ * one after the other from that same file.
+ * @since 1.0
+ */
+TEST_CASE("tracked table round-trips checkpoints through a single file", "[checkpoint]")
+{
+    const std::string path = tempfile();
+    const int fd = ::open(path.c_str(), O_RDWR | O_TRUNC);
+    table_t table (3000, 128);
+
+    for (size_t i = 0; i < table.size(); ++i)
+        table.assign(i, st::tuple_t<uint32_t, double, char>((uint32_t) i, i * 2., char('a' + i % 26)));
+
+    const size_t full = table.checkpoint(fd, true);
+    table.at<0>(1234) = 42;
+    table.push_back(st::tuple_t<uint32_t, double, char>(7, 7., 'z'));
+    const size_t delta = table.checkpoint(fd);
+
+    REQUIRE(::lseek(fd, 0, SEEK_CUR) == (off_t) (full + delta));
+    ::lseek(fd, 0, SEEK_SET);
+
+    table_t restored;
+    restored.restore(fd);
+    REQUIRE(restored.size() == 3000);
+    REQUIRE(restored.column<0>()[1234] == 1234);
+    REQUIRE(::lseek(fd, 0, SEEK_CUR) == (off_t) full);
+
+    restored.restore(fd);
+    check(restored, table);
+
+    ::close(fd);
+    std::remove(path.c_str());
+}
+
+/**
+ * Tests whether checkpoints of mismatching tables or truncated files are rejected.
+ * @since 1.0
+ */
+TEST_CASE("tracked table rejects malformed checkpoints", "[checkpoint]")
+{
+    const std::string path = tempfile();
+    table_t table (500, 10);
+    table.checkpoint(path, true);
+
+    st::tracked_soa_t<uint64_t, double, char> other;
+    REQUIRE_THROWS_AS(other.restore(path), std::runtime_error);
+
+    ::truncate(path.c_str(), 100);
+    table_t truncated;
+    REQUIRE_THROWS_AS(truncated.restore(path), std::runtime_error);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,117 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the strided column views over arrays of tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/column_view.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether a column view reaches the same elements as direct tuple accesses,
+ * and whether writes through the view change the underlying tuples.
+ * @since 1.0
+ */
+TEST_CASE("column view element access", "[column_view]")
+{
+    std::vector<st::tuple_t<int32_t, std::string, double, char>> rows;
+
+    for (int i = 0; i < 100; ++i)
+        rows.emplace_back(i, std::to_string(i), i * 0.5, (char) ('a' + i % 26));
+
+    auto ints = st::column_view<0>(rows);
+    auto names = st::column_view<1>(rows);
+    const auto& view = rows;
+    auto chars = st::column_view<3>(view);
+
+    REQUIRE(ints.size() == 100);
+    REQUIRE(ints.stride() == (std::ptrdiff_t) sizeof(rows[0]));
+
+    for (size_t i = 0; i < rows.size(); ++i) {
+        REQUIRE(&ints[i] == &st::get<0>(rows[i]));
+        REQUIRE(names[i] == st::get<1>(rows[i]));
+        REQUIRE(chars[i] == st::get<3>(rows[i]));
+    }
+
+    std::sort(ints.begin(), ints.end(), [](int a, int b) { return a > b; });
+    REQUIRE(st::get<0>(rows.front()) == 99);
+    REQUIRE(st::get<0>(rows.back()) == 0);
+    REQUIRE(st::get<1>(rows.front()) == "0");
+
+    names[5] = "five";
+    REQUIRE(st::get<1>(rows[5]) == "five");
+    REQUIRE(std::count(chars.begin(), chars.end(), 'a') == 4);
+    REQUIRE(chars.end() - chars.begin() == 100);
+
+    REQUIRE(st::column_view<0>(rows.data(), 0).empty());
+    REQUIRE(st::column_view<0>(rows.data(), 0).sum() == 0);
+}
+
+/**
+ * Tests whether the aggregate kernels over a column view agree with plain loops,
+ * for column lengths around the kernels' vector and unroll widths.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE("column view aggregate kernels", "[column_view]", int8_t, uint8_t, int32_t, int64_t, float, double, long double)
+{
+    for (size_t n : {0, 1, 3, 7, 17, 64, 1000, 4097}) {
+        std::vector<st::tuple_t<char, TestType, std::array<char, 13>>> rows (n);
+
+        for (size_t i = 0; i < n; ++i)
+            st::get<1>(rows[i]) = (TestType) ((int) ((i * 37) % 101) - 50);
+
+        const auto column = st::column_view<1>(std::as_const(rows));
+        std::vector<TestType> plain (n);
+        for (size_t i = 0; i < n; ++i) plain[i] = st::get<1>(rows[i]);
+
+        using sum_t = std::conditional_t<std::is_integral_v<TestType>,
+            std::conditional_t<std::is_signed_v<TestType>, int64_t, uint64_t>, TestType>;
+
+        const sum_t sum = std::accumulate(plain.begin(), plain.end(), sum_t(0));
+        REQUIRE(std::is_same_v<decltype(column.sum()), sum_t>);
+        REQUIRE(column.sum() == sum);
+
+        if (n > 0) {
+            REQUIRE(column.min() == *std::min_element(plain.begin(), plain.end()));
+            REQUIRE(column.max() == *std::max_element(plain.begin(), plain.end()));
+        } else {
+            REQUIRE(column.min() > 0);
+            REQUIRE(column.max() < column.min());
+        }
+
+        auto positive = [](TestType x) { return x > 0; };
+        REQUIRE(column.count_if(positive) == (size_t) std::count_if(plain.begin(), plain.end(), positive));
+    }
+}
+
+/**
+ * Tests whether NaNs are ignored when finding the extremes of a floating column.
+ * @since 1.0
+ */
+TEST_CASE("column view extremes ignore NaNs", "[column_view]")
+{
+    std::vector<st::tuple_t<int, double>> rows (50);
+    for (size_t i = 0; i < rows.size(); ++i) st::get<1>(rows[i]) = (double) i;
+
+    st::get<1>(rows[0]) = std::nan("");
+    st::get<1>(rows[49]) = std::nan("");
+
+    auto column = st::column_view<1>(rows);
+
+    REQUIRE(column.min() == 1.0);
+    REQUIRE(column.max() == 48.0);
+}
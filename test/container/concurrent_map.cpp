@@ -0,0 +1,149 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the lock-striped concurrent hash map keyed by tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/concurrent_map.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether keys are inserted, assigned, updated, found and erased, including
+ * when the shards' tables are grown and entries are shifted back on erasure.
+ * @since 1.0
+ */
+TEST_CASE("concurrent map basic operations", "[concurrent_map]")
+{
+    st::concurrent_tuple_map<st::tuple_t<int, int>, int> map (4, 8);
+
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(map.insert(st::tuple_t(i, -i), i * 2));
+
+    REQUIRE(map.size() == 1000);
+    REQUIRE(!map.insert(st::tuple_t(7, -7), 0));
+    REQUIRE(map.insert_or_assign(st::tuple_t(7, -7), 70) == false);
+    REQUIRE(map.upsert(st::tuple_t(8, -8), [](int& v) { v += 1; }) == false);
+    REQUIRE(map.upsert(st::tuple_t(5000, 1), [](int& v) { v += 1; }) == true);
+
+    REQUIRE(*map.find(st::tuple_t(7, -7)) == 70);
+    REQUIRE(*map.find(st::tuple_t(8, -8)) == 17);
+    REQUIRE(*map.find(st::tuple_t(5000, 1)) == 1);
+    REQUIRE(!map.find(st::tuple_t(7, 7)).has_value());
+
+    for (int i = 0; i < 1000; i += 2)
+        REQUIRE(map.erase(st::tuple_t(i, -i)));
+
+    REQUIRE(!map.erase(st::tuple_t(0, 0)));
+    REQUIRE(map.size() == 501);
+
+    for (int i = 1; i < 1000; i += 2) {
+        if (i == 7) continue;
+        REQUIRE(map.contains(st::tuple_t(i, -i)));
+        REQUIRE(*map.find(st::tuple_t(i, -i)) == i * 2);
+    }
+
+    for (int i = 0; i < 1000; i += 2)
+        REQUIRE(!map.contains(st::tuple_t(i, -i)));
+
+    map.clear();
+    REQUIRE(map.size() == 0);
+    REQUIRE(!map.contains(st::tuple_t(1, -1)));
+}
+
+/**
+ * Tests whether keys are looked up by tuples of references to values of other
+ * types that hash and compare equally, without building an owning key.
+ * @since 1.0
+ */
+TEST_CASE("concurrent map heterogeneous lookup", "[concurrent_map]")
+{
+    st::concurrent_tuple_map<st::tuple_t<std::string, int>, double> map;
+
+    map.insert(st::tuple_t<std::string, int>("alpha", 1), 1.5);
+    map.insert(st::tuple_t<std::string, int>("beta", 2), 2.5);
+
+    std::string_view name = "beta";
+    int id = 2;
+
+    REQUIRE(*map.find(st::tie(name, id)) == 2.5);
+    REQUIRE(!map.contains(st::tie(name, (id = 3))));
+    REQUIRE(map.erase(st::tuple_t<std::string_view, int>("alpha", 1)));
+    REQUIRE(map.size() == 1);
+}
+
+/**
+ * Tests whether a write which throws still releases its shard, so that lock-free
+ * readers and later writers of the shard are not left waiting for it.
+ * @since 1.0
+ */
+TEST_CASE("concurrent map after a throwing update", "[concurrent_map]")
+{
+    st::concurrent_tuple_map<st::tuple_t<int, int>, int> map (1);
+    map.insert(st::tuple_t(1, 1), 10);
+
+    REQUIRE_THROWS_AS(map.upsert(st::tuple_t(1, 1), [](int&) { throw std::runtime_error("update"); }), std::runtime_error);
+    REQUIRE_THROWS_AS(map.upsert(st::tuple_t(2, 2), [](int&) { throw std::runtime_error("update"); }), std::runtime_error);
+
+    REQUIRE(*map.find(st::tuple_t(1, 1)) == 10);
+    REQUIRE(*map.find(st::tuple_t(2, 2)) == 0);
+    REQUIRE(map.insert_or_assign(st::tuple_t(2, 2), 20) == false);
+    REQUIRE(*map.find(st::tuple_t(2, 2)) == 20);
+}
+
+/**
+ * Tests whether concurrent updates of shared keys are atomic and whether lock-free
+ * readers only ever observe consistent values, while writers grow the tables.
+ * @since 1.0
+ */
+TEST_CASE("concurrent map under concurrent writers and readers", "[concurrent_map]")
+{
+    st::concurrent_tuple_map<st::tuple_t<uint32_t, uint32_t>, st::tuple_t<uint64_t, uint64_t>> map (8);
+    std::atomic<bool> done = false;
+    std::atomic<size_t> inconsistent = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 4; ++t)
+        threads.emplace_back([&]() {
+            for (uint32_t i = 0; i < 20000; ++i)
+                map.upsert(st::tuple_t(i % 5000, i % 7), [](auto& v) {
+                    st::get<0>(v) += 1;
+                    st::get<1>(v) += 2;
+                });
+        });
+
+    for (size_t t = 0; t < 2; ++t)
+        threads.emplace_back([&]() {
+            while (!done.load()) {
+                for (uint32_t i = 0; i < 5000; ++i) {
+                    const auto value = map.find(st::tuple_t(i, i % 7));
+                    if (value && st::get<1>(*value) != 2 * st::get<0>(*value)) ++inconsistent;
+                }
+            }
+        });
+
+    for (size_t t = 0; t < 4; ++t) threads[t].join();
+    done = true;
+    for (size_t t = 4; t < threads.size(); ++t) threads[t].join();
+
+    uint64_t total = 0;
+
+    for (uint32_t k = 0; k < 5000; ++k)
+        for (uint32_t r = 0; r < 7; ++r)
+            if (const auto value = map.find(st::tuple_t(k, r))) total += st::get<0>(*value);
+
+    REQUIRE(inconsistent == 0);
+    REQUIRE(total == 4 * 20000);
+    REQUIRE(map.size() == 20000);
+}
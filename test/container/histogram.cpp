@@ -0,0 +1,110 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the log-linear latency histogram.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/histogram.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether values are counted in buckets whose bounds enclose them, and whether
+ * the buckets' widths are bounded relatively to their values.
+ * @since 1.0
+ */
+TEST_CASE("latency histogram bucket bounds", "[histogram]")
+{
+    using histogram_t = st::latency_histogram<8>;
+
+    STATIC_REQUIRE(histogram_t::count == 8 * 62);
+    STATIC_REQUIRE(histogram_t::bucket(0) == 0);
+    STATIC_REQUIRE(histogram_t::bucket(7) == 7);
+    STATIC_REQUIRE(histogram_t::bucket(8) == 8);
+    STATIC_REQUIRE(histogram_t::bucket(16) == 16);
+    STATIC_REQUIRE(histogram_t::bucket(17) == 16);
+    STATIC_REQUIRE(histogram_t::bucket(std::numeric_limits<uint64_t>::max()) == histogram_t::count - 1);
+
+    for (size_t i = 0; i + 1 < histogram_t::count; ++i) {
+        REQUIRE(histogram_t::upper(i) + 1 == histogram_t::lower(i + 1));
+        REQUIRE(histogram_t::bucket(histogram_t::lower(i)) == i);
+        REQUIRE(histogram_t::bucket(histogram_t::upper(i)) == i);
+    }
+
+    std::mt19937_64 random (42);
+
+    for (size_t i = 0; i < 10000; ++i) {
+        const uint64_t value = random() >> (random() % 64);
+        const size_t index = histogram_t::bucket(value);
+        REQUIRE(histogram_t::lower(index) <= value);
+        REQUIRE(value <= histogram_t::upper(index));
+        REQUIRE(histogram_t::upper(index) - histogram_t::lower(index) <= value / 8);
+    }
+}
+
+/**
+ * Tests whether percentiles are estimated within the buckets' relative error, and
+ * whether values beyond a narrow histogram's range are saturated.
+ * @since 1.0
+ */
+TEST_CASE("latency histogram percentiles", "[histogram]")
+{
+    st::latency_histogram<16> histogram;
+
+    REQUIRE(histogram.total() == 0);
+    REQUIRE(histogram.percentile(50) == 0);
+
+    for (uint64_t value = 1; value <= 10000; ++value)
+        histogram.record(value);
+
+    REQUIRE(histogram.total() == 10000);
+
+    for (double p : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9, 100.0}) {
+        const double exact = p * 100.0;
+        const double estimate = (double) histogram.percentile(p);
+        REQUIRE(estimate >= exact);
+        REQUIRE(estimate <= exact * (1.0 + 1.0 / 16));
+    }
+
+    REQUIRE(histogram.percentile(0) == 1);
+    histogram.record(5, 1000000);
+    REQUIRE(histogram.percentile(50) == 5);
+
+    histogram.reset();
+    REQUIRE(histogram.total() == 0);
+
+    st::latency_histogram<4, 4> narrow;
+    narrow.record(1000);
+    REQUIRE(st::get<narrow.count - 1>(narrow.counts()) == 1);
+    REQUIRE(narrow.percentile(100) == std::numeric_limits<uint64_t>::max());
+}
+
+/**
+ * Tests whether merged histograms count the same as a single histogram recording
+ * all of their values.
+ * @since 1.0
+ */
+TEST_CASE("latency histogram merge", "[histogram]")
+{
+    st::latency_histogram<> a, b, all;
+    std::mt19937_64 random (7);
+
+    for (size_t i = 0; i < 5000; ++i) {
+        const uint64_t value = random() % 1000000;
+        (i % 3 ? a : b).record(value);
+        all.record(value);
+    }
+
+    a.merge(b);
+
+    REQUIRE(a.total() == 5000);
+    REQUIRE(a.counts() == all.counts());
+    REQUIRE(a.percentile(99) == all.percentile(99));
+}
@@ -0,0 +1,100 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the hash-consing tuple interner.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/interner.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether distinct tuples get dense stable ids, while repeated tuples get the
+ * ids they were first given, and whether strings are copied into the interner.
+ * @since 1.0
+ */
+TEST_CASE("interner deduplicates tuples", "[interner]")
+{
+    st::interner<st::tuple_t<std::string_view, int, int>> interner;
+    std::vector<uint32_t> ids;
+
+    for (int i = 0; i < 20000; ++i) {
+        std::string name = "attr-" + std::to_string(i % 1000);
+        int a = (i / 1000) % 7, b = i % 2;
+        ids.push_back(interner.intern(st::tie(name, a, b)));
+    }
+
+    REQUIRE(interner.size() == 7000);
+
+    for (int i = 0; i < 20000; ++i) {
+        const auto value = interner[ids[i]];
+        REQUIRE(st::get<0>(value) == "attr-" + std::to_string(i % 1000));
+        REQUIRE(st::get<1>(value) == (i / 1000) % 7);
+        REQUIRE(st::get<2>(value) == i % 2);
+        REQUIRE(ids[i] < interner.size());
+    }
+
+    std::string name = "attr-42";
+    int a = 0, b = 0;
+
+    REQUIRE(interner.find(st::tie(name, a, b)) == ids[42]);
+    REQUIRE(interner.find(st::tuple_t<std::string_view, int, int>("attr-42", 0, 0)) == ids[42]);
+    REQUIRE(!interner.find(st::tuple_t<std::string_view, int, int>("missing", 0, 0)).has_value());
+    REQUIRE(interner.intern(st::tie(name, a, b)) == ids[42]);
+    REQUIRE(interner.size() == 7000);
+
+    REQUIRE(interner.column<1>().size() == 7000);
+    REQUIRE(interner.intern(st::tuple_t<std::string_view, int, int>("", 0, 0)) == 7000);
+    REQUIRE(st::get<0>(interner[7000]).empty());
+}
+
+/**
+ * Tests whether concurrent threads interning overlapping tuples agree on their ids.
+ * @since 1.0
+ */
+TEST_CASE("concurrent interner agrees on ids", "[interner]")
+{
+    st::concurrent_interner<st::tuple_t<std::string_view, int, int>> interner (8);
+
+    constexpr size_t threads = 4;
+    constexpr int count = 5000;
+
+    std::vector<std::vector<uint32_t>> ids (threads);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; ++t)
+        workers.emplace_back([&, t]() {
+            for (int i = 0; i < count; ++i) {
+                const int k = (int) (i * (t + 1)) % count;
+                std::string name = "k" + std::to_string(k % 500);
+                int key = k, negated = -k;
+                ids[t].push_back(interner.intern(st::tie(name, key, negated)));
+            }
+        });
+
+    for (auto& worker : workers) worker.join();
+
+    REQUIRE(interner.size() == (size_t) count);
+
+    for (int k = 0; k < count; ++k) {
+        std::string name = "k" + std::to_string(k % 500);
+        int key = k, negated = -k;
+        const auto id = interner.find(st::tie(name, key, negated));
+        REQUIRE(id.has_value());
+        REQUIRE(interner[*id] == st::tuple_t<std::string_view, int, int>(name, k, -k));
+        REQUIRE(*id == ids[0][k]);
+    }
+
+    for (size_t t = 1; t < threads; ++t)
+        for (int i = 0; i < count; ++i)
+            REQUIRE(ids[t][i] == ids[0][(int) (i * (t + 1)) % count]);
+}
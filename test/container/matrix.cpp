@@ -0,0 +1,82 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the fixed-size matrix type and its kernels.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cmath>
+#include <cstdint>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/matrix.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Checks whether two floating-point matrices are approximately equal.
+ * @tparam N The matrices' size.
+ * @param a The first matrix to compare.
+ * @param b The second matrix to compare.
+ * @return Are the matrices approximately equal?
+ */
+template <size_t N>
+static bool approx(const st::matrix_t<double, N, N>& a, const st::matrix_t<double, N, N>& b)
+{
+    for (size_t i = 0; i < N; ++i)
+        for (size_t j = 0; j < N; ++j)
+            if (std::abs(a(i, j) - b(i, j)) > 1e-9) return false;
+    return true;
+}
+
+/**
+ * Tests whether matrix products, transposes and element accesses are computed.
+ * @since 1.0
+ */
+TEST_CASE("matrix products and transposes", "[matrix]")
+{
+    const st::matrix_t<int, 2, 3> a (1, 2, 3, 4, 5, 6);
+    const st::matrix_t<int, 3, 2> b (7, 8, 9, 10, 11, 12);
+
+    REQUIRE(a * b == st::matrix_t<int, 2, 2>(58, 64, 139, 154));
+    REQUIRE(st::transpose(a) == st::matrix_t<int, 3, 2>(1, 4, 2, 5, 3, 6));
+    REQUIRE(a * st::ntuple_t<int, 3>(1, 0, -1) == st::ntuple_t<int, 2>(-2, -2));
+
+    REQUIRE(a.at<1, 2>() == 6);
+    REQUIRE(a(1, 0) == 4);
+
+    auto m = st::matrix_t<float, 4, 4>::identity();
+    m(2, 3) = 5.f;
+
+    REQUIRE(m.at<2, 3>() == 5.f);
+    REQUIRE(m * st::matrix_t<float, 4, 4>::identity() == m);
+    REQUIRE(alignof(st::matrix_t<float, 4, 4>) >= 16);
+}
+
+/**
+ * Tests whether determinants and inverses are computed for small and larger sizes.
+ * @since 1.0
+ */
+TEST_CASE("matrix determinants and inverses", "[matrix]")
+{
+    REQUIRE(st::determinant(st::matrix_t<int, 2, 2>(3, 8, 4, 6)) == -14);
+    REQUIRE(st::determinant(st::matrix_t<int, 3, 3>(6, 1, 1, 4, -2, 5, 2, 8, 7)) == -306);
+    REQUIRE(st::determinant(st::matrix_t<int, 4, 4>(1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0)) == 30);
+
+    const st::matrix_t<double, 3, 3> m3 (2, -1, 0, -1, 2, -1, 0, -1, 2);
+    REQUIRE(approx(m3 * st::inverse(m3), st::matrix_t<double, 3, 3>::identity()));
+
+    const st::matrix_t<double, 6, 6> m6 (
+        4, 1, 0, 0, 2, 1
+      , 1, 5, 1, 0, 0, 0
+      , 0, 1, 6, 1, 0, 3
+      , 0, 0, 1, 7, 1, 0
+      , 2, 0, 0, 1, 8, 1
+      , 1, 0, 3, 0, 1, 9);
+
+    REQUIRE(approx(m6 * st::inverse(m6), st::matrix_t<double, 6, 6>::identity()));
+    REQUIRE(std::abs(st::determinant(m6) * st::determinant(st::inverse(m6)) - 1.) < 1e-9);
+
+    const auto singular = st::inverse(st::matrix_t<double, 4, 4>(1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 1, 1, 1, 1));
+    REQUIRE(std::isnan(singular(0, 0)));
+}
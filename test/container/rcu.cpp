@@ -0,0 +1,149 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the read-copy-update published tuple snapshots.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/rcu.hpp>
+
+namespace st = supertuple;
+
+namespace
+{
+    /**
+     * A value that counts how many of its instances are alive.
+     * @since 1.0
+     */
+    struct counted_t
+    {
+        inline static std::atomic<int> alive = 0;
+        int value = 0;
+
+        inline counted_t(int value = 0) : value (value) { ++alive; }
+        inline counted_t(const counted_t& other) : value (other.value) { ++alive; }
+        inline counted_t& operator=(const counted_t&) = default;
+        inline ~counted_t() { --alive; }
+    };
+}
+
+/**
+ * Tests whether edits are published as new snapshots while snapshots already held
+ * by readers remain untouched.
+ * @since 1.0
+ */
+TEST_CASE("rcu tuple publishes edits as new snapshots", "[rcu]")
+{
+    using config_t = st::tuple_t<std::vector<int>, std::map<std::string, int>, int>;
+    st::rcu_tuple<std::vector<int>, std::map<std::string, int>, int> config (
+        config_t(std::vector<int>{1, 2, 3}, std::map<std::string, int>{{"a", 1}}, 0));
+
+    auto before = config.read();
+
+    config.set<2>(42);
+    config.apply([](config_t& value) {
+        st::get<0>(value).push_back(4);
+        st::get<1>(value)["b"] = 2;
+    });
+
+    auto after = config.read();
+
+    REQUIRE(st::get<0>(*before) == std::vector<int>{1, 2, 3});
+    REQUIRE(st::get<1>(*before).size() == 1);
+    REQUIRE(st::get<2>(*before) == 0);
+
+    REQUIRE(st::get<0>(*after) == std::vector<int>{1, 2, 3, 4});
+    REQUIRE(st::get<1>(*after).at("b") == 2);
+    REQUIRE(st::get<2>(*after) == 42);
+
+    config.publish(config_t(std::vector<int>(), std::map<std::string, int>(), 7));
+    REQUIRE(st::get<2>(*config.read()) == 7);
+    REQUIRE(st::get<2>(*after) == 42);
+}
+
+/**
+ * Tests whether retired snapshots are only reclaimed once no reader holds them.
+ * @since 1.0
+ */
+TEST_CASE("rcu tuple reclaims snapshots after readers leave", "[rcu]")
+{
+    {
+        st::rcu_tuple<counted_t> value (st::tuple_t<counted_t>(0));
+        REQUIRE(counted_t::alive == 1);
+
+        {
+            auto held = value.read();
+
+            for (int i = 1; i <= 10; ++i)
+                value.set<0>(counted_t(i));
+
+            REQUIRE(value.collect() > 0);
+            REQUIRE(st::get<0>(*held).value == 0);
+            REQUIRE(counted_t::alive > 1);
+        }
+
+        value.synchronize();
+        REQUIRE(value.collect() == 0);
+        REQUIRE(counted_t::alive == 1);
+        REQUIRE(st::get<0>(*value.read()).value == 10);
+    }
+
+    REQUIRE(counted_t::alive == 0);
+}
+
+/**
+ * Tests whether concurrent readers always observe consistent snapshots while
+ * concurrent writers publish edits, and whether no edit is lost.
+ * @since 1.0
+ */
+TEST_CASE("rcu tuple concurrent readers and writers", "[rcu]")
+{
+    using state_t = st::tuple_t<std::vector<int>, int>;
+    st::rcu_tuple<std::vector<int>, int> state;
+
+    constexpr int writers = 2;
+    constexpr int edits = 500;
+
+    std::atomic<bool> done = false;
+    std::atomic<size_t> mismatches = 0;
+    std::vector<std::thread> threads;
+
+    for (int r = 0; r < 4; ++r)
+        threads.emplace_back([&]() {
+            do {
+                auto snapshot = state.read();
+                const auto& items = st::get<0>(*snapshot);
+                if ((int) items.size() != st::get<1>(*snapshot)) ++mismatches;
+                for (size_t i = 0; i < items.size(); ++i)
+                    if (items[i] != (int) i) { ++mismatches; break; }
+            } while (!done.load());
+        });
+
+    std::vector<std::thread> editors;
+
+    for (int w = 0; w < writers; ++w)
+        editors.emplace_back([&]() {
+            for (int i = 0; i < edits; ++i)
+                state.apply([](state_t& value) {
+                    st::get<0>(value).push_back(st::get<1>(value)++);
+                });
+        });
+
+    for (auto& editor : editors) editor.join();
+    done = true;
+    for (auto& thread : threads) thread.join();
+
+    state.synchronize();
+
+    REQUIRE(mismatches == 0);
+    REQUIRE(st::get<1>(*state.read()) == writers * edits);
+    REQUIRE(st::get<0>(*state.read()).size() == size_t(writers * edits));
+}
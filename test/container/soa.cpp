@@ -0,0 +1,43 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the structure-of-arrays container of tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/soa.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether rows are scattered to and gathered from contiguous columns.
+ * @since 1.0
+ */
+TEST_CASE("structure-of-arrays rows and columns", "[soa]")
+{
+    st::soa_t<int, std::string, double> soa;
+
+    soa.push_back(st::tuple_t(1, std::string("one"), 1.5));
+    soa.push_back(st::tuple_t(2, std::string("two"), 2.5));
+
+    REQUIRE(soa.size() == 2);
+    REQUIRE(soa.column<0>() == std::vector<int>{1, 2});
+    REQUIRE(soa.gather(1) == st::tuple_t(2, std::string("two"), 2.5));
+
+    st::get<2>(soa[0]) = 9.;
+
+    REQUIRE(soa.column<2>()[0] == 9.);
+
+    soa.resize(5);
+
+    REQUIRE(soa.column<1>().size() == 5);
+    REQUIRE(soa[4] == st::tuple_t(0, std::string(), 0.));
+
+    soa.clear();
+
+    REQUIRE(soa.empty());
+}
@@ -0,0 +1,132 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the read-only sorted sets.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/sorted_set.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Generates a sequence of ascending even values.
+ * @tparam N The sequence's length.
+ * @return The generated sequence.
+ */
+template <size_t N>
+static constexpr std::array<int, N> evens()
+{
+    std::array<int, N> data {};
+    for (size_t i = 0; i < N; ++i) data[i] = (int) (((i * 7919) % N) * 2);
+    return data;
+}
+
+/**
+ * Checks the lower bounds of a set against the standard binary search.
+ * @tparam S The set's type.
+ * @param set The set to be checked.
+ * @param sorted The set's elements in ascending order.
+ * @param lo The smallest value to be searched.
+ * @param hi The largest value to be searched.
+ */
+template <typename S>
+static void check(const S& set, const std::vector<int>& sorted, int lo, int hi)
+{
+    for (int x = lo; x <= hi; ++x) {
+        auto expected = std::lower_bound(sorted.begin(), sorted.end(), x);
+        const int *bound = set.lower_bound(x);
+
+        if (expected == sorted.end()) REQUIRE(bound == nullptr);
+        else REQUIRE((bound && *bound == *expected));
+
+        REQUIRE(set.contains(x) == std::binary_search(sorted.begin(), sorted.end(), x));
+    }
+}
+
+/**
+ * Tests whether small static sorted sets, which are scanned linearly, are built
+ * at compile-time and answer queries as a binary search would.
+ * @since 1.0
+ */
+TEST_CASE("small static sorted set", "[sorted_set]")
+{
+    static constexpr st::static_sorted_set set (st::ntuple_t<int, 6>(9, 3, 7, 1, 3, 12));
+
+    STATIC_REQUIRE(set.size() == 6);
+
+    REQUIRE(set.contains(7));
+    REQUIRE(!set.contains(8));
+    REQUIRE(*set.lower_bound(4) == 7);
+    REQUIRE(*set.lower_bound(-5) == 1);
+    REQUIRE(set.lower_bound(13) == nullptr);
+
+    check(set, {1, 3, 3, 7, 9, 12}, -2, 14);
+}
+
+/**
+ * Tests whether large static sorted sets, which are kept in Eytzinger layout, are
+ * built at compile-time and answer queries as a binary search would.
+ * @since 1.0
+ */
+TEST_CASE("large static sorted set", "[sorted_set]")
+{
+    static constexpr auto data = evens<300>();
+    static constexpr st::static_sorted_set set (st::ntuple_t<int, 300>(data.data()));
+
+    std::vector<int> sorted (data.begin(), data.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    STATIC_REQUIRE(set.size() == 300);
+    check(set, sorted, -3, 602);
+}
+
+/**
+ * Tests whether run-time sorted sets of various sizes remove duplicates and answer
+ * queries as a binary search would, regardless of their layout.
+ * @since 1.0
+ */
+TEST_CASE("run-time sorted set", "[sorted_set]")
+{
+    std::mt19937 rng (42);
+
+    for (size_t n : {0, 1, 2, 63, 64, 65, 100, 1000, 4097}) {
+        std::uniform_int_distribution<int> dist (0, (int) n * 3);
+        std::vector<int> values (n);
+        for (auto& x : values) x = dist(rng);
+
+        st::sorted_set<int> set (values.begin(), values.end());
+
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+
+        REQUIRE(set.size() == values.size());
+        check(set, values, -1, (int) n * 3 + 1);
+    }
+}
+
+/**
+ * Tests whether run-time sorted sets work with floating-point elements.
+ * @since 1.0
+ */
+TEST_CASE("run-time sorted set of doubles", "[sorted_set]")
+{
+    std::vector<double> values;
+    for (size_t i = 0; i < 200; ++i) values.push_back(i * .5);
+
+    st::sorted_set<double> set (values);
+
+    REQUIRE(set.size() == 200);
+    REQUIRE(set.contains(42.5));
+    REQUIRE(!set.contains(42.25));
+    REQUIRE(*set.lower_bound(42.25) == 42.5);
+    REQUIRE(set.lower_bound(100.) == nullptr);
+}
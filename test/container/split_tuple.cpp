@@ -0,0 +1,112 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the hot and cold split tuple layout.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/split_tuple.hpp>
+
+namespace st = supertuple;
+
+namespace
+{
+    /**
+     * A large and rarely accessed buffer.
+     * @since 1.0
+     */
+    using buffer_t = std::array<char, 512>;
+
+    /**
+     * A record with hot integers around a cold buffer and a cold string.
+     * @since 1.0
+     */
+    using record_t = st::split_tuple<0, 2>::type<int, buffer_t, double, std::string>;
+}
+
+/**
+ * Tests whether elements keep their logical indeces, and whether only the hot part
+ * is kept inline.
+ * @since 1.0
+ */
+TEST_CASE("split tuple layout", "[split_tuple]")
+{
+    STATIC_REQUIRE(std::is_same_v<record_t::hot_t, st::tuple_t<int, double>>);
+    STATIC_REQUIRE(std::is_same_v<record_t::cold_t, st::tuple_t<buffer_t, std::string>>);
+    STATIC_REQUIRE(sizeof(record_t) < 64);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<record_t>);
+
+    buffer_t buffer {};
+    buffer[0] = 'x';
+
+    record_t record (7, buffer, 2.5, std::string("debug"));
+
+    REQUIRE(st::get<0>(record) == 7);
+    REQUIRE(st::get<1>(record)[0] == 'x');
+    REQUIRE(st::get<2>(record) == 2.5);
+    REQUIRE(st::get<3>(record) == "debug");
+    REQUIRE(record.boxed());
+
+    st::get<0>(record) = 8;
+    st::get<3>(record) += "-info";
+
+    REQUIRE(record.hot_part() == st::tuple_t<int, double>(8, 2.5));
+    REQUIRE(record.gather() == st::tuple_t<int, buffer_t, double, std::string>(8, buffer, 2.5, "debug-info"));
+}
+
+/**
+ * Tests whether the cold part is only allocated when written to, and whether copies
+ * and moves preserve all elements.
+ * @since 1.0
+ */
+TEST_CASE("split tuple copies and moves", "[split_tuple]")
+{
+    record_t empty;
+    const record_t& view = empty;
+
+    REQUIRE(!empty.boxed());
+    REQUIRE(st::get<3>(view).empty());
+    REQUIRE(st::get<1>(view)[0] == 0);
+    REQUIRE(!empty.boxed());
+
+    st::get<2>(empty) = 1.0;
+    REQUIRE(!empty.boxed());
+
+    record_t copy = empty;
+    REQUIRE(!copy.boxed());
+    REQUIRE(copy == empty);
+
+    st::get<3>(copy) = "cold";
+    REQUIRE(copy.boxed());
+    REQUIRE(copy != empty);
+
+    record_t other = copy;
+    REQUIRE(other == copy);
+    st::get<3>(other) = "changed";
+    REQUIRE(st::get<3>(copy) == "cold");
+
+    record_t moved = std::move(other);
+    REQUIRE(st::get<3>(moved) == "changed");
+    REQUIRE(st::get<2>(moved) == 1.0);
+
+    copy = moved;
+    REQUIRE(copy == moved);
+
+    std::vector<record_t> records (1000);
+    for (size_t i = 0; i < records.size(); ++i) st::get<0>(records[i]) = (int) i;
+
+    long sum = 0;
+    for (const auto& r : records) sum += st::get<0>(r);
+
+    REQUIRE(sum == 999 * 1000 / 2);
+    for (const auto& r : records) REQUIRE(!r.boxed());
+}
@@ -0,0 +1,80 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the compile-time perfect-hash static map.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/container/static_map.hpp>
+
+namespace st = supertuple;
+
+enum class opcode_t : uint8_t { nop, load, store, add, jump };
+
+/**
+ * Tests whether a static map keyed by strings is built at compile-time and finds
+ * all of its keys, while rejecting unknown ones.
+ * @since 1.0
+ */
+TEST_CASE("static map keyed by strings", "[static_map]")
+{
+    static constexpr st::static_map names (st::tuple_t(
+        st::pair_t("nop", opcode_t::nop)
+      , st::pair_t("load", opcode_t::load)
+      , st::pair_t("store", opcode_t::store)
+      , st::pair_t("add", opcode_t::add)
+      , st::pair_t("jump", opcode_t::jump)));
+
+    STATIC_REQUIRE(std::is_same_v<decltype(names)::key_t, std::string_view>);
+    STATIC_REQUIRE(names.size() == 5);
+    STATIC_REQUIRE(*names.find("store") == opcode_t::store);
+    STATIC_REQUIRE(names.value_or("halt", opcode_t::nop) == opcode_t::nop);
+
+    REQUIRE(names.contains(std::string("jump")));
+    REQUIRE(*names.find(std::string("load")) == opcode_t::load);
+    REQUIRE(names.find("loads") == nullptr);
+    REQUIRE(names.find("") == nullptr);
+}
+
+/**
+ * Tests whether a larger static map keyed by enums and integers maps all of its keys
+ * to their values through a single probe.
+ * @since 1.0
+ */
+TEST_CASE("static map keyed by integers", "[static_map]")
+{
+    static constexpr st::static_map mnemonics (st::ntuple_t<st::pair_t<opcode_t, const char*>, 3>(
+        st::pair_t(opcode_t::load, "ld")
+      , st::pair_t(opcode_t::store, "st")
+      , st::pair_t(opcode_t::jump, "jmp")));
+
+    REQUIRE(std::string_view(*mnemonics.find(opcode_t::store)) == "st");
+    REQUIRE(mnemonics.find(opcode_t::add) == nullptr);
+
+    static constexpr auto squares = st::static_map(st::tuple_t(
+        st::pair_t(1, 1), st::pair_t(2, 4), st::pair_t(3, 9), st::pair_t(4, 16)
+      , st::pair_t(5, 25), st::pair_t(6, 36), st::pair_t(7, 49), st::pair_t(8, 64)
+      , st::pair_t(9, 81), st::pair_t(10, 100), st::pair_t(11, 121), st::pair_t(12, 144)
+      , st::pair_t(13, 169), st::pair_t(14, 196), st::pair_t(15, 225), st::pair_t(16, 256)
+      , st::pair_t(17, 289), st::pair_t(18, 324), st::pair_t(19, 361), st::pair_t(20, 400)
+      , st::pair_t(-1, 1), st::pair_t(-2, 4), st::pair_t(1000, 1000000), st::pair_t(65536, 0)));
+
+    STATIC_REQUIRE(squares.size() == 24);
+
+    for (int i = 1; i <= 20; ++i)
+        REQUIRE(*squares.find(i) == i * i);
+
+    REQUIRE(squares.value_or(1000, 0) == 1000000);
+    REQUIRE(squares.contains(65536));
+    REQUIRE(!squares.contains(0));
+    REQUIRE(!squares.contains(21));
+    REQUIRE(!squares.contains(-3));
+
+    REQUIRE_THROWS_AS(st::static_map(st::tuple_t(st::pair_t(1, 1), st::pair_t(1, 2))), std::invalid_argument);
+}
@@ -0,0 +1,162 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the Arrow C Data Interface export and import.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/io/arrow.hpp>
+
+namespace st = supertuple;
+
+namespace
+{
+    /**
+     * The table of tuples exchanged by the tests.
+     * @since 1.0
+     */
+    using table_t = st::soa_t<int32_t, double, uint8_t, int64_t>;
+
+    /**
+     * Builds a table with a known value in every cell.
+     * @param n The number of rows.
+     * @return The built table.
+     */
+    table_t build(size_t n)
+    {
+        table_t table;
+        for (size_t i = 0; i < n; ++i)
+            table.push_back(st::tuple_t<int32_t, double, uint8_t, int64_t>(
+                (int32_t) i - 500, i * 0.5, (uint8_t) (i % 256), (int64_t) i << 33));
+        return table;
+    }
+}
+
+/**
+ * Tests whether the exported schema describes a struct of the table's columns, with
+ * formats derived from the columns' element types.
+ * @since 1.0
+ */
+TEST_CASE("arrow schema export", "[arrow]")
+{
+    ArrowSchema schema;
+    st::io::export_schema<int32_t, double, uint8_t, int64_t>(&schema, {"id", "score", "flag", "stamp"});
+
+    REQUIRE(std::strcmp(schema.format, "+s") == 0);
+    REQUIRE(schema.n_children == 4);
+
+    const char *formats[] = {"i", "g", "C", "l"};
+    const char *names[] = {"id", "score", "flag", "stamp"};
+
+    for (size_t i = 0; i < 4; ++i) {
+        REQUIRE(std::strcmp(schema.children[i]->format, formats[i]) == 0);
+        REQUIRE(std::strcmp(schema.children[i]->name, names[i]) == 0);
+        REQUIRE(schema.children[i]->release != nullptr);
+    }
+
+    schema.release(&schema);
+    REQUIRE(schema.release == nullptr);
+
+    st::io::export_schema<float, int8_t, uint16_t, uint64_t>(&schema);
+    REQUIRE(std::strcmp(schema.children[0]->format, "f") == 0);
+    REQUIRE(std::strcmp(schema.children[1]->format, "c") == 0);
+    REQUIRE(std::strcmp(schema.children[2]->format, "S") == 0);
+    REQUIRE(std::strcmp(schema.children[3]->format, "L") == 0);
+    REQUIRE(std::strcmp(schema.children[3]->name, "3") == 0);
+    schema.release(&schema);
+
+    REQUIRE_THROWS_AS(st::io::export_schema<int32_t>(&schema, {"a", "b"}), std::invalid_argument);
+}
+
+/**
+ * Tests whether a table round trips through the interface without its columns being
+ * copied, and whether the imported table releases the exported array.
+ * @since 1.0
+ */
+TEST_CASE("arrow round trip", "[arrow]")
+{
+    const table_t table = build(1000);
+
+    ArrowSchema schema;
+    ArrowArray array;
+
+    st::io::export_schema<int32_t, double, uint8_t, int64_t>(&schema);
+    st::io::export_array(table, &array);
+
+    REQUIRE(array.length == 1000);
+    REQUIRE(array.n_children == 4);
+    REQUIRE(array.children[1]->buffers[1] == table.column<1>().data());
+
+    {
+        auto imported = st::io::import_array<int32_t, double, uint8_t, int64_t>(schema, &array);
+        REQUIRE(array.release == nullptr);
+        REQUIRE(imported.size() == 1000);
+        REQUIRE(&imported.column<0>()[0] == table.column<0>().data());
+
+        for (size_t i = 0; i < table.size(); ++i)
+            REQUIRE(imported.gather(i) == table.gather(i));
+
+        REQUIRE(imported.column<3>().max() == (int64_t) 999 << 33);
+        REQUIRE(imported.column<0>().sum() == 499500 - 500000);
+    }
+
+    schema.release(&schema);
+}
+
+/**
+ * Tests whether an exported array may own its table, and whether sliced arrays are
+ * imported from their offsets.
+ * @since 1.0
+ */
+TEST_CASE("arrow owned export and slices", "[arrow]")
+{
+    ArrowSchema schema;
+    ArrowArray array;
+
+    st::io::export_schema<int32_t, double, uint8_t, int64_t>(&schema);
+    st::io::export_array(build(100), &array);
+
+    array.offset = 10;
+    array.length = 20;
+
+    auto imported = st::io::import_array<int32_t, double, uint8_t, int64_t>(schema, &array);
+    auto moved = std::move(imported);
+
+    REQUIRE(moved.size() == 20);
+    REQUIRE(moved.gather(0) == st::tuple_t<int32_t, double, uint8_t, int64_t>(-490, 5.0, 10, (int64_t) 10 << 33));
+    REQUIRE(moved.column<2>()[19] == 29);
+
+    schema.release(&schema);
+}
+
+/**
+ * Tests whether arrays which do not match the table's columns are rejected, and are
+ * released nevertheless.
+ * @since 1.0
+ */
+TEST_CASE("arrow import validation", "[arrow]")
+{
+    ArrowSchema schema;
+    ArrowArray array;
+
+    st::io::export_schema<int32_t, double, uint8_t, int64_t>(&schema);
+    st::io::export_array(build(10), &array);
+
+    REQUIRE_THROWS_AS((st::io::import_array<int32_t, float, uint8_t, int64_t>(schema, &array)), std::runtime_error);
+    REQUIRE(array.release == nullptr);
+    REQUIRE_THROWS_AS((st::io::import_array<int32_t, double, uint8_t, int64_t>(schema, &array)), std::invalid_argument);
+
+    st::io::export_array(build(10), &array);
+    array.children[0]->null_count = 1;
+    REQUIRE_THROWS_AS((st::io::import_array<int32_t, double, uint8_t, int64_t>(schema, &array)), std::runtime_error);
+
+    schema.release(&schema);
+}
@@ -0,0 +1,100 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the asynchronous tuple record sink.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <catch.hpp>
+#include <supertuple.h>
+#include <supertuple/io/sink.hpp>
+
+namespace st = supertuple;
+
+/**
+ * Creates a new empty temporary file.
+ * @return The path of the created file.
+ */
+static std::string tempfile()
+{
+    char name[] = "/tmp/supertuple-XXXXXX";
+    ::close(::mkstemp(name));
+    return name;
+}
+
+/**
+ * Reads back all records from a file written by a sink.
+ * @tparam T The type of records in the file.
+ * @param path The path of the file to be read.
+ * @return The list of decoded records.
+ */
+template <typename T>
+static std::vector<T> readback(const std::string& path)
+{
+    std::ifstream file (path, std::ios::binary);
+    std::vector<char> bytes ((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::vector<T> records (bytes.size() / st::io::record_size_v<T>);
+    st::io::decode(reinterpret_cast<const std::byte*>(bytes.data()), records.data(), records.size());
+    return records;
+}
+
+/**
+ * Tests whether batches of tuples written through a sink are durably appended to
+ * the target file in order, with both the io_uring backend, when available, and
+ * the synchronous fallback. Completion callbacks must be invoked for every request.
+ * @since 1.0
+ */
+TEST_CASE("async sink appends tuple batches to a file", "[io][sink]")
+{
+    using record_t = st::tuple_t<uint32_t, double, char>;
+    const bool uring = GENERATE(true, false);
+    const std::string path = tempfile();
+
+    std::vector<record_t> expected;
+    std::atomic<size_t> written = 0, synced = 0, failed = 0;
+
+    {
+        st::io::sink_options_t options;
+        options.allow_uring = uring;
+        options.max_inflight_bytes = 1024;
+        options.queue_depth = 4;
+
+        st::io::async_sink_t sink (path.c_str(), options);
+        REQUIRE((!uring ? !sink.uring() : true));
+
+        for (uint32_t i = 0; i < 100; ++i) {
+            std::vector<record_t> batch;
+            for (uint32_t j = 0; j < 10; ++j)
+                batch.push_back(record_t(i * 10 + j, i * .5, char('a' + j)));
+
+            sink.write(batch.data(), batch.size(), [&](std::error_code error, size_t bytes) {
+                if (error) ++failed;
+                written += bytes; });
+
+            expected.insert(expected.end(), batch.begin(), batch.end());
+
+            if (i % 25 == 24)
+                sink.sync([&](std::error_code error, size_t) { error ? ++failed : ++synced; });
+        }
+
+        sink.flush();
+
+        REQUIRE(failed == 0);
+        REQUIRE(synced == 4);
+        REQUIRE(written == expected.size() * st::io::record_size_v<record_t>);
+        REQUIRE(sink.size() == written);
+    }
+
+    REQUIRE(readback<record_t>(path) == expected);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,54 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the flatten operation over tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <supertuple.h>
+
+namespace st = supertuple;
+
+/**
+ * Tests the flatten operation over nested tuple instances. The expected behaviour
+ * of this operation is to produce a single tuple with the leaves of all nested
+ * tuples, at any depth, in order.
+ * @since 1.0
+ */
+TEST_CASE("flatten-operation over nested tuples", "[flatten][owning]")
+{
+    constexpr auto t = st::tuple_t(1, st::tuple_t(2, st::pair_t(3, 4.0)), st::ntuple_t<int, 2>(5, 6), 7);
+    constexpr auto r = st::flatten(t);
+
+    STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(r)>, st::tuple_t<int, int, int, double, int, int, int>>);
+    STATIC_REQUIRE(r == st::tuple_t(1, 2, 3, 4.0, 5, 6, 7));
+    STATIC_REQUIRE(st::flatten(st::tuple_t(1, 2)) == st::tuple_t(1, 2));
+}
+
+/**
+ * Tests the flatten operation over moving nested tuples and tuples with references.
+ * The expected behaviour is for leaves to be moved and references to be kept.
+ * @since 1.0
+ */
+TEST_CASE("flatten-operation over moving tuples and references", "[flatten][move]")
+{
+    int x = 1;
+    auto t = st::tuple_t(std::make_unique<int>(2), st::tuple_t(std::string("abc"), std::make_unique<int>(3)));
+    auto r = st::flatten(std::move(t));
+
+    STATIC_REQUIRE(decltype(r)::count == 3);
+    REQUIRE(*st::get<0>(r) == 2);
+    REQUIRE(st::get<1>(r) == "abc");
+    REQUIRE(*st::get<2>(r) == 3);
+    REQUIRE(st::get<0>(t) == nullptr);
+
+    auto f = st::flatten(st::tuple_t<int&, st::tuple_t<int>>(x, st::tuple_t(2)));
+    x = 5;
+
+    STATIC_REQUIRE(std::is_same_v<decltype(f), st::tuple_t<int&, int>>);
+    REQUIRE(f == st::tuple_t(5, 2));
+}
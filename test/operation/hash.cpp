@@ -0,0 +1,40 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the hash operation over tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include <catch.hpp>
+#include <supertuple.h>
+
+namespace st = supertuple;
+
+/**
+ * Tests the hash operation over tuples that own their elements and tuples of references.
+ * The expected behaviour of this operation is to produce the same hash for tuples
+ * with equal values, independently of whether they own or refer to their elements.
+ * @since 1.0
+ */
+TEST_CASE("hash-operation over owning and reference tuples", "[hash][ref]")
+{
+    std::string name = "supertuple";
+    int version = 1;
+
+    const auto t1 = st::tuple_t(std::string("supertuple"), 1);
+    const auto t2 = st::tie(name, version);
+    const auto t3 = st::tuple_t(std::string_view("supertuple"), 1);
+
+    REQUIRE(st::hash(t1) == st::hash(t2));
+    REQUIRE(st::hash(t1) == st::hash(t3));
+    REQUIRE(st::hash(t1) != st::hash(st::tuple_t(1, std::string("supertuple"))));
+    REQUIRE(st::hash(st::tuple_t(1, 2)) != st::hash(st::tuple_t(2, 1)));
+
+    std::unordered_set<st::tuple_t<int, int>> set = { {1, 2}, {3, 4} };
+
+    REQUIRE(set.count(st::tuple_t(1, 2)) == 1);
+    REQUIRE(set.count(st::tuple_t(2, 1)) == 0);
+}
@@ -0,0 +1,106 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the interoperability with standard tuple-like types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <array>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <catch.hpp>
+#include <supertuple.h>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether tuples can be constructed directly from standard tuple-like types.
+ * @since 1.0
+ */
+TEST_CASE("tuples constructed from standard tuple-like types", "[interop][construct]")
+{
+    constexpr auto t = st::tuple_t<int, double, char>(std::tuple(1, 2.0, 'c'));
+    constexpr auto p = st::pair_t<int, long>(std::pair(3, 4L));
+    constexpr auto n = st::ntuple_t<int, 3>(std::array<int, 3>{5, 6, 7});
+
+    STATIC_REQUIRE(t == st::tuple_t(1, 2.0, 'c'));
+    STATIC_REQUIRE(p == st::tuple_t(3, 4L));
+    STATIC_REQUIRE(n == st::tuple_t(5, 6, 7));
+
+    const auto s = st::tuple_t<std::string>(std::tuple<std::string>("abc"));
+    const auto w = st::tuple_t<std::tuple<int>>(std::tuple<int>(8));
+
+    REQUIRE(st::get<0>(s) == "abc");
+    REQUIRE(std::get<0>(st::get<0>(w)) == 8);
+
+    auto source = std::tuple(std::make_unique<int>(9), std::string("xyz"));
+    auto moved = st::tuple_t<std::unique_ptr<int>, std::string>(std::move(source));
+
+    REQUIRE(*st::get<0>(moved) == 9);
+    REQUIRE(std::get<0>(source) == nullptr);
+}
+
+/**
+ * Tests whether operations accept standard tuple-like types without conversions.
+ * @since 1.0
+ */
+TEST_CASE("operations over standard tuple-like types", "[interop][operation]")
+{
+    constexpr auto a = std::array<int, 3>{1, 2, 3};
+    constexpr auto b = st::tuple_t(4.0, 'e');
+
+    constexpr auto c = st::concat(a, b);
+    STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(c)>, st::tuple_t<int, int, int, double, char>>);
+    STATIC_REQUIRE(c == st::tuple_t(1, 2, 3, 4.0, 'e'));
+    STATIC_REQUIRE(st::concat(std::pair(1, 2), std::tuple(3)) == st::tuple_t(1, 2, 3));
+
+    constexpr auto z = st::zip(std::tuple(1, 2), st::tuple_t('a', 'b'));
+    STATIC_REQUIRE(z == st::tuple_t(st::pair_t(1, 'a'), st::pair_t(2, 'b')));
+
+    constexpr auto r = st::apply(a, [](int x) { return x * 2; });
+    STATIC_REQUIRE(r == st::tuple_t(2, 4, 6));
+
+    STATIC_REQUIRE(st::foldl(a, [](int x, int y) { return x - y; }, 10) == 4);
+    STATIC_REQUIRE(st::foldl(std::tuple(1, 2.5, 3), [](double x, double y) { return x + y; }) == 6.5);
+
+    auto words = std::tuple(std::string("a"), std::string("b"));
+    const auto joined = st::concat(std::move(words), st::tuple_t(std::string("c")));
+
+    REQUIRE(joined == st::tuple_t(std::string("a"), std::string("b"), std::string("c")));
+    REQUIRE(std::get<0>(words).empty());
+}
+
+/**
+ * Tests the conversions to and from the standard tuple-like types.
+ * @since 1.0
+ */
+TEST_CASE("conversions to and from standard tuple-like types", "[interop][convert]")
+{
+    constexpr auto t = st::to_std(st::tuple_t(1, 'b'));
+    constexpr auto p = st::to_std(st::pair_t(1, 2.0));
+    constexpr auto n = st::to_std(st::ntuple_t<int, 3>(1, 2, 3));
+
+    STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(t)>, std::tuple<int, char>>);
+    STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(p)>, std::pair<int, double>>);
+    STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(n)>, std::array<int, 3>>);
+    STATIC_REQUIRE(t == std::tuple(1, 'b'));
+    REQUIRE(n == std::array<int, 3>{1, 2, 3});
+
+    STATIC_REQUIRE(st::from_std(t) == st::tuple_t(1, 'b'));
+    STATIC_REQUIRE(st::from_std(p) == st::pair_t(1, 2.0));
+    STATIC_REQUIRE(std::is_same_v<decltype(st::from_std(n)), st::ntuple_t<int, 3>>);
+
+    auto u = st::tuple_t(std::make_unique<int>(1), std::string("abc"));
+    auto v = st::to_std(std::move(u));
+
+    REQUIRE(*std::get<0>(v) == 1);
+    REQUIRE(st::get<0>(u) == nullptr);
+
+    auto w = st::from_std(std::move(v));
+
+    REQUIRE(*st::get<0>(w) == 1);
+    REQUIRE(std::get<1>(v).empty());
+}
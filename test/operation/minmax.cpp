@@ -0,0 +1,111 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the n-tuple extreme value and find operations.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <catch.hpp>
+#include <supertuple.h>
+
+namespace st = supertuple;
+
+/**
+ * Tests whether the extreme values of arithmetic n-tuples are found, for sizes that
+ * are not multiples of the vector width and with repeated extreme values.
+ * @since 1.0
+ */
+TEMPLATE_TEST_CASE("extreme values of arithmetic n-tuples", "[minmax]", float, double, long double, int8_t, uint16_t, int32_t, int64_t)
+{
+    TestType data[37];
+
+    for (size_t i = 0; i < 37; ++i)
+        data[i] = (TestType) ((i * 7) % 37 + 3);
+
+    data[30] = (TestType) 3;
+    const st::ntuple_t<TestType, 37> t (data);
+
+    REQUIRE(st::min(t) == (TestType) 3);
+    REQUIRE(st::max(t) == (TestType) 39);
+    REQUIRE(st::argmin(t) == 0);
+    REQUIRE(st::argmax(t) == 36 * 16 % 37);
+    REQUIRE(st::minmax(t) == st::pair_t<TestType, TestType>(3, 39));
+
+    REQUIRE(st::find(t, 10) == 1);
+    REQUIRE(st::find(t, 2) == 37);
+    REQUIRE(st::find(st::ntuple_t<TestType, 3>(1, 2, 3), 3) == 2);
+}
+
+/**
+ * Tests whether searched values are never narrowed to the elements' type, so that
+ * values which cannot be represented by it never match any element.
+ * @since 1.0
+ */
+TEST_CASE("find values of other arithmetic types", "[minmax]")
+{
+    const st::ntuple_t<int, 8> t (1, 2, 3, 4, 5, 6, 7, 8);
+    const st::ntuple_t<unsigned, 4> u (1u, 2u, 3u, 4294967295u);
+
+    REQUIRE(st::find(t, 2.5) == 8);
+    REQUIRE(st::find(t, 3.0) == 2);
+    REQUIRE(st::find(t, (int64_t) 4) == 3);
+    REQUIRE(st::find(t, (int64_t) 1 << 32 | 5) == 8);
+    REQUIRE(st::find(u, -1) == 4);
+    REQUIRE(st::find(u, 4294967295ll) == 3);
+    REQUIRE(st::find(u, 2) == 1);
+
+    REQUIRE(st::find(t, 1e20) == 8);
+    REQUIRE(st::find(t, -1e20) == 8);
+    REQUIRE(st::find(t, std::nan("")) == 8);
+    REQUIRE(st::find(u, 4294967296.0) == 4);
+    REQUIRE(st::find(u, 4294967295.0) == 3);
+    REQUIRE(st::find(st::ntuple_t<float, 2>(1.f, 2.f), 1e300) == 2);
+}
+
+/**
+ * Tests whether NaN elements are either propagated to or ignored by the results.
+ * @since 1.0
+ */
+TEST_CASE("extreme values of n-tuples with NaNs", "[minmax][nan]")
+{
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    float data[20] = {4, 2, 8, 1, 9, 5, 7, 3, 6, 0.5f, 11, 12, 13, 14, 15, 16, nan, 18, 19, 20};
+
+    const st::ntuple_t<float, 20> t (data);
+
+    REQUIRE(std::isnan(st::min(t)));
+    REQUIRE(std::isnan(st::max(t)));
+    REQUIRE(st::argmin(t) == 16);
+
+    REQUIRE(st::min<st::nan_policy_t::ignore>(t) == .5f);
+    REQUIRE(st::max<st::nan_policy_t::ignore>(t) == 20.f);
+    REQUIRE(st::argmin<st::nan_policy_t::ignore>(t) == 9);
+    REQUIRE(st::argmax<st::nan_policy_t::ignore>(t) == 19);
+
+    const st::ntuple_t<float, 5> empty (nan, nan, nan, nan, nan);
+
+    REQUIRE(std::isnan(st::min<st::nan_policy_t::ignore>(empty)));
+    REQUIRE(st::argmax<st::nan_policy_t::ignore>(empty) == 5);
+    REQUIRE(st::find(t, nan) == 20);
+}
+
+/**
+ * Tests whether n-tuples of non-arithmetic types are searched with scalar compares.
+ * @since 1.0
+ */
+TEST_CASE("extreme values of non-arithmetic n-tuples", "[minmax]")
+{
+    const st::ntuple_t<std::string, 4> t (
+        std::string("pear"), std::string("apple"), std::string("plum"), std::string("apple"));
+
+    REQUIRE(st::min(t) == "apple");
+    REQUIRE(st::max(t) == "plum");
+    REQUIRE(st::argmin(t) == 1);
+    REQUIRE(st::argmax(t) == 2);
+    REQUIRE(st::find(t, "plum") == 2);
+    REQUIRE(st::find(t, "kiwi") == 4);
+}
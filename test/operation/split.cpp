@@ -0,0 +1,83 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the split and chunk operations over tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <supertuple.h>
+
+namespace st = supertuple;
+
+/**
+ * Tests the split operation over tuple instances. The expected behaviour of this
+ * operation is to produce a pair of tuples referencing the original elements.
+ * @since 1.0
+ */
+TEST_CASE("split-operation over tuples", "[split][ref]")
+{
+    auto t = st::tuple_t(1, std::string("abc"), 3.0, 'd');
+    auto [a, b] = st::split_at<1>(t);
+
+    STATIC_REQUIRE(std::is_same_v<decltype(a), st::tuple_t<int&>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(b), st::tuple_t<std::string&, double&, char&>>);
+
+    st::get<0>(b) = "xyz";
+
+    REQUIRE(st::get<1>(t) == "xyz");
+    REQUIRE(a == st::tuple_t(1));
+
+    static constexpr auto n = st::ntuple_t<int, 5>(1, 2, 3, 4, 5);
+    constexpr auto s = st::split_at<2>(n);
+
+    STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(s)>, st::pair_t<st::ntuple_t<const int&, 2>, st::ntuple_t<const int&, 3>>>);
+    STATIC_REQUIRE(s.first() == st::tuple_t(1, 2));
+    STATIC_REQUIRE(s.second() == st::tuple_t(3, 4, 5));
+
+    auto m = st::split_at<1>(st::tuple_t(std::make_unique<int>(1), std::make_unique<int>(2)));
+
+    REQUIRE(*st::get<0>(m.second()) == 2);
+}
+
+/**
+ * Tests the chunk operation over n-tuples. The expected behaviour of this operation
+ * is to produce whole chunks of references followed by a remainder, and to allow
+ * whole chunks to be dispatched to a fixed-width kernel while iterating over them.
+ * @since 1.0
+ */
+TEST_CASE("chunk-operation over n-tuples", "[chunk][ref]")
+{
+    auto t = st::ntuple_t<int, 10>(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+    auto c = st::chunk<4>(t);
+
+    STATIC_REQUIRE(decltype(c)::count == 3);
+    STATIC_REQUIRE(std::is_same_v<st::tuple_element_t<decltype(c), 0>, st::ntuple_t<int&, 4>>);
+    STATIC_REQUIRE(std::is_same_v<st::tuple_element_t<decltype(c), 2>, st::ntuple_t<int&, 2>>);
+
+    int kernels = 0, tails = 0;
+
+    st::foreach(c, [&](auto& chunk) {
+        if constexpr (std::remove_reference_t<decltype(chunk)>::count == 4) {
+            chunk = st::apply(chunk, [](int x) { return x * 10; });
+            ++kernels;
+        } else {
+            st::foreach(chunk, [](int& x) { x = -x; });
+            ++tails;
+        }
+    });
+
+    REQUIRE(kernels == 2);
+    REQUIRE(tails == 1);
+    REQUIRE(t == st::tuple_t(0, 10, 20, 30, 40, 50, 60, 70, -8, -9));
+
+    static constexpr auto u = st::ntuple_t<int, 4>(1, 2, 3, 4);
+    constexpr auto d = st::chunk<2>(u);
+
+    STATIC_REQUIRE(decltype(d)::count == 3);
+    STATIC_REQUIRE(st::get<1>(d) == st::tuple_t(3, 4));
+    STATIC_REQUIRE(st::tuple_element_t<decltype(d), 2>::count == 0);
+}
@@ -0,0 +1,70 @@
+/**
+ * SuperTuple: A powerful and light-weight C++ tuple implementation.
+ * @file Test cases for the unzip operation over tuples.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <string>
+
+#include <catch.hpp>
+#include <supertuple.h>
+
+namespace st = supertuple;
+
+/**
+ * Counts the number of times instances of a type are copied and moved.
+ * @since 1.0
+ */
+struct counter_t
+{
+    inline static int copies = 0;
+    inline static int moves = 0;
+
+    counter_t() = default;
+    counter_t(const counter_t&) { ++copies; }
+    counter_t(counter_t&&) { ++moves; }
+};
+
+/**
+ * Tests the unzip operation over tuple instances of pairs. The expected behaviour
+ * of this operation is to produce a pair of tuples, inverting a zip.
+ * @since 1.0
+ */
+TEST_CASE("unzip-operation over tuples of pairs", "[unzip][owning]")
+{
+    constexpr auto t1 = st::tuple_t(1, 2, 3);
+    constexpr auto t2 = st::tuple_t(2.0, 4.0, 6.0);
+
+    constexpr auto r = st::unzip(st::zip(t1, t2));
+
+    STATIC_REQUIRE(r.first() == t1);
+    STATIC_REQUIRE(r.second() == t2);
+
+    const auto s = st::unzip(st::tuple_t(st::pair_t(std::string("a"), 1), st::pair_t(std::string("b"), 2)));
+
+    REQUIRE(s.first() == st::tuple_t(std::string("a"), std::string("b")));
+    REQUIRE(s.second() == st::tuple_t(1, 2));
+}
+
+/**
+ * Tests whether unzipping moves or copies each element exactly once.
+ * @since 1.0
+ */
+TEST_CASE("unzip-operation moves each element once", "[unzip][move]")
+{
+    auto t = st::tuple_t(st::pair_t(counter_t(), 1), st::pair_t(counter_t(), 2));
+
+    counter_t::copies = counter_t::moves = 0;
+    auto r = st::unzip(std::move(t));
+
+    REQUIRE(counter_t::copies == 0);
+    REQUIRE(counter_t::moves == 2);
+    REQUIRE(r.second() == st::tuple_t(1, 2));
+
+    counter_t::copies = counter_t::moves = 0;
+    const auto c = st::unzip(t);
+
+    REQUIRE(counter_t::copies == 2);
+    REQUIRE(counter_t::moves == 0);
+    REQUIRE(c.second() == st::tuple_t(1, 2));
+}